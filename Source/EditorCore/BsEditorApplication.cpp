@@ -3,6 +3,7 @@
 #include "BsEditorApplication.h"
 #include "EditorWindow/BsEditorWindowManager.h"
 #include "EditorWindow/BsEditorWidgetManager.h"
+#include "EditorWindow/BsEditorWidgetProfiler.h"
 #include "EditorWindow/BsMainEditorWindow.h"
 #include "RenderAPI/BsRenderWindow.h"
 #include "Utility/BsBuiltinEditorResources.h"
@@ -13,6 +14,8 @@
 #include "Scene/BsScenePicking.h"
 #include "Scene/BsSelection.h"
 #include "Scene/BsGizmoManager.h"
+#include "Scene/BsSceneBoundsCache.h"
+#include "Scene/BsSceneChangeNotifier.h"
 #include "CodeEditor/BsCodeEditor.h"
 #include "Build/BsBuildManager.h"
 #include "Resources/BsScriptCodeImporter.h"
@@ -109,35 +112,48 @@ namespace bs
 		}
 
 		UndoRedo::startUp();
+		EditorWidgetProfiler::startUp();
 		EditorWindowManager::startUp();
 		EditorWidgetManager::startUp();
 		DropDownWindowManager::startUp();
 
+		SceneChangeNotifier::startUp();
 		ScenePicking::startUp();
 		Selection::startUp();
+		SceneBoundsCache::startUp();
 		GizmoManager::startUp();
 		BuildManager::startUp();
 		CodeEditorManager::startUp();
 
 		MainEditorWindow::create(getPrimaryWindow());
+		connectWindowDirtyEvents();
+
 		ScriptManager::startUp();
 	}
 
 	void EditorApplication::onShutDown()
 	{
+		for (auto& conn : mWindowDirtyConns)
+			conn.disconnect();
+
+		mWindowDirtyConns.clear();
+
 		unloadProject();
 
 		CodeEditorManager::shutDown();
 		BuildManager::shutDown();
 		GizmoManager::shutDown();
+		SceneBoundsCache::shutDown();
 		Selection::shutDown();
 		ScenePicking::shutDown();
+		SceneChangeNotifier::shutDown();
 
 		saveEditorSettings();
 
 		DropDownWindowManager::shutDown();
 		EditorWidgetManager::shutDown();
 		EditorWindowManager::shutDown();
+		EditorWidgetProfiler::shutDown();
 		UndoRedo::shutDown();
 
 		Application::onShutDown();
@@ -180,7 +196,14 @@ namespace bs
 
 		// Call update on editor widgets before parent's postUpdate because the parent will render the GUI and we need
 		// to ensure editor widget's GUI is updated.
-		EditorWindowManager::instance().update();
+		EditorWindowManager& windowManager = EditorWindowManager::instance();
+		windowManager.setIdleModeEnabled(mEditorSettings->getIdleModeEnabled() && !mSplashScreenShown);
+
+		// Keep windows updating while import progress is being reported
+		if (gProjectLibrary().getInProgressImportCount() > 0)
+			windowManager.markAllDirty();
+
+		windowManager.update();
 
 		Application::postUpdate();
 
@@ -195,7 +218,24 @@ namespace bs
 			}
 		}
 
-		setFPSLimit(mEditorSettings->getFPSLimit());
+		// Throttle the main loop if no window needed an update this frame
+		if (windowManager.isIdle())
+			setFPSLimit(mEditorSettings->getIdleFPSLimit());
+		else
+			setFPSLimit(mEditorSettings->getFPSLimit());
+	}
+
+	void EditorApplication::connectWindowDirtyEvents()
+	{
+		auto markAllDirty = []() { EditorWindowManager::instance().markAllDirty(); };
+		auto markAllDirtyPath = [](const Path&) { EditorWindowManager::instance().markAllDirty(); };
+
+		mWindowDirtyConns.push_back(UndoRedo::instance().onStackChanged.connect(markAllDirty));
+		mWindowDirtyConns.push_back(Selection::instance().onSelectionChanged.connect(
+			[](const Vector<HSceneObject>&, const Vector<Path>&) { EditorWindowManager::instance().markAllDirty(); }));
+		mWindowDirtyConns.push_back(gProjectLibrary().onEntryAdded.connect(markAllDirtyPath));
+		mWindowDirtyConns.push_back(gProjectLibrary().onEntryRemoved.connect(markAllDirtyPath));
+		mWindowDirtyConns.push_back(gProjectLibrary().onEntryImported.connect(markAllDirtyPath));
 	}
 
 	void EditorApplication::quitRequested()
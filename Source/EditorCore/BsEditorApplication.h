@@ -125,6 +125,12 @@ namespace bs
 		/** @copydoc Application::getShaderIncludeHandler */
 		SPtr<IShaderIncludeHandler> getShaderIncludeHandler() const override;
 
+		/** 
+		 * Registers listeners for events that can change the contents of any editor window (scene, selection and project
+		 * library changes), so windows get updated when idle mode is active.
+		 */
+		void connectWindowDirtyEvents();
+
 	private:
 		static const Path WIDGET_LAYOUT_PATH;
 		static const Path BUILD_DATA_PATH;
@@ -139,6 +145,8 @@ namespace bs
 
 		Timer mSplashScreenTimer;
 		bool mSplashScreenShown = true;
+
+		Vector<HEvent> mWindowDirtyConns;
 	};
 
 	/**	Easy way to access EditorApplication. */
@@ -20,6 +20,7 @@ set(BS_BANSHEEEDITOR_INC_EDITORWINDOW
 	"EditorWindow/BsEditorWidgetContainer.h"
 	"EditorWindow/BsEditorWidgetLayout.h"
 	"EditorWindow/BsEditorWidgetManager.h"
+	"EditorWindow/BsEditorWidgetProfiler.h"
 	"EditorWindow/BsEditorWindow.h"
 	"EditorWindow/BsEditorWindowBase.h"
 	"EditorWindow/BsEditorWindowManager.h"
@@ -29,6 +30,9 @@ set(BS_BANSHEEEDITOR_INC_EDITORWINDOW
 
 set(BS_BANSHEEEDITOR_INC_SCENE
 	"Scene/BsGizmoManager.h"
+	"Scene/BsSceneBVH.h"
+	"Scene/BsSceneBoundsCache.h"
+	"Scene/BsSceneChangeNotifier.h"
 	"Scene/BsSceneGrid.h"
 	"Scene/BsScenePicking.h"
 	"Scene/BsSelection.h"
@@ -126,6 +130,7 @@ set(BS_BANSHEEEDITOR_INC_UNDOREDO
 	"UndoRedo/BsCmdInstantiateSO.h"
 	"UndoRedo/BsCmdBreakPrefab.h"
 	"UndoRedo/BsUndoRedo.h"
+	"UndoRedo/BsUndoRedoArena.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_RTTI
@@ -150,6 +155,9 @@ set(BS_BANSHEEEDITOR_SRC_SCENE
 	"Scene/BsSelectionRenderer.cpp"
 	"Scene/BsSelection.cpp"
 	"Scene/BsScenePicking.cpp"
+	"Scene/BsSceneBVH.cpp"
+	"Scene/BsSceneBoundsCache.cpp"
+	"Scene/BsSceneChangeNotifier.cpp"
 	"Scene/BsSceneGrid.cpp"
 	"Scene/BsSerializedSceneObject.cpp"
 )
@@ -174,6 +182,7 @@ set(BS_BANSHEEEDITOR_INC_HANDLES
 set(BS_BANSHEEEDITOR_SRC_UTILITY
 	"Utility/BsEditorUtility.cpp"
 	"Utility/BsSplashScreen.cpp"
+	"Utility/BsBidirectionalDiff.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_EDITORWINDOW
@@ -187,6 +196,7 @@ set(BS_BANSHEEEDITOR_SRC_EDITORWINDOW
 	"EditorWindow/BsEditorWindowBase.cpp"
 	"EditorWindow/BsEditorWindow.cpp"
 	"EditorWindow/BsEditorWidgetManager.cpp"
+	"EditorWindow/BsEditorWidgetProfiler.cpp"
 	"EditorWindow/BsEditorWidgetLayout.cpp"
 	"EditorWindow/BsEditorWidgetContainer.cpp"
 	"EditorWindow/BsEditorWidget.cpp"
@@ -196,10 +206,15 @@ set(BS_BANSHEEEDITOR_INC_UTILITY
 	"Utility/BsEditorUtility.h"
 	"Utility/BsBuiltinEditorResources.h"
 	"Utility/BsSplashScreen.h"
+	"Utility/BsBidirectionalDiff.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_TESTING
 	"Testing/BsEditorTestSuite.cpp"
+	"Testing/BsEditorBenchmark.cpp"
+	"Testing/BsSceneViewBenchmark.cpp"
+	"Testing/BsUndoRedoBenchmark.cpp"
+	"Testing/BsSceneSaveBenchmark.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_SETTINGS
@@ -218,6 +233,7 @@ set(BS_BANSHEEEDITOR_SRC_UNDOREDO
 	"UndoRedo/BsCmdInstantiateSO.cpp"
 	"UndoRedo/BsCmdBreakPrefab.cpp"
 	"UndoRedo/BsUndoRedo.cpp"
+	"UndoRedo/BsUndoRedoArena.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_BUILD
@@ -245,6 +261,10 @@ set(BS_BANSHEEEDITOR_SRC_HANDLES
 
 set(BS_BANSHEEEDITOR_INC_TESTING
 	"Testing/BsEditorTestSuite.h"
+	"Testing/BsEditorBenchmark.h"
+	"Testing/BsSceneViewBenchmark.h"
+	"Testing/BsUndoRedoBenchmark.h"
+	"Testing/BsSceneSaveBenchmark.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_CODEEDITOR
@@ -8,6 +8,7 @@
 #include "GUI/BsGUIPanel.h"
 #include "EditorWindow/BsEditorWidgetContainer.h"
 #include "EditorWindow/BsEditorWidgetManager.h"
+#include "EditorWindow/BsEditorWidgetProfiler.h"
 #include "EditorWindow/BsEditorWindow.h"
 #include "RenderAPI/BsRenderWindow.h"
 
@@ -22,6 +23,9 @@ namespace bs
 
 	EditorWidgetBase::~EditorWidgetBase()
 	{
+		if (EditorWidgetProfiler::isStarted())
+			EditorWidgetProfiler::instance()._notifyWidgetDestroyed(this);
+
 		if (mContent != nullptr)
 			GUILayout::destroy(mContent);
 	}
@@ -62,6 +66,15 @@ namespace bs
 		parentContainer->setActiveWidget(mIndex);
 	}
 
+	void EditorWidgetBase::markDirty()
+	{
+		mIsDirty = true;
+
+		EditorWindowBase* parentWindow = getParentWindow();
+		if (parentWindow != nullptr)
+			parentWindow->markDirty();
+	}
+
 	void EditorWidgetBase::close()
 	{
 		EditorWidgetManager::instance().close(this);
@@ -84,6 +97,7 @@ namespace bs
 		if(mContent != nullptr)
 			mContent->setPosition(x, y);
 
+		markDirty();
 		doOnMoved(x, y);
 	}
 
@@ -101,6 +115,7 @@ namespace bs
 			mContent->setHeight(height);
 		}
 
+		markDirty();
 		doOnResized(width, height);
 	}
 
@@ -110,6 +125,7 @@ namespace bs
 		{
 			mHasFocus = focus;
 
+			markDirty();
 			onFocusChanged(focus);
 		}
 	}
@@ -180,6 +196,7 @@ namespace bs
 			mParent = parent;
 			mIndex = indx;
 
+			markDirty();
 			doOnParentChanged();
 
 			if(!onParentChanged.empty())
@@ -197,6 +214,8 @@ namespace bs
 	{
 		mContent->setVisible(true);
 		mIsActive = true;
+
+		markDirty();
 	}
 
 	GUIWidget& EditorWidgetBase::getParentWidget() const
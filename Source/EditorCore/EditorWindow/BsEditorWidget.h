@@ -89,6 +89,27 @@ namespace bs
 		/** Internal method. Called once per frame.	*/
 		virtual void update() { }
 
+		/** 
+		 * Notifies the widget that its contents changed and need to be updated and redrawn. When idle mode is active 
+		 * widgets that are not dirty will not be updated.
+		 */
+		void markDirty();
+
+		/** Checks has the widget been marked as dirty since it was last updated. */
+		bool isDirty() const { return mIsDirty; }
+
+		/** 
+		 * Determines should the widget be updated every frame even when idle mode is active. Should be enabled for widgets
+		 * that animate or display contents that change on their own.
+		 */
+		void setContinuousUpdate(bool enabled) { mContinuousUpdate = enabled; }
+
+		/** @copydoc setContinuousUpdate */
+		bool getContinuousUpdate() const { return mContinuousUpdate; }
+
+		/** Returns the number of frames the widget update was skipped due to idle mode. */
+		UINT64 getNumSkippedFrames() const { return mNumSkippedFrames; }
+
 		Event<void(UINT32, UINT32)> onResized; /**< Triggered whenever widget size changes. */
 		Event<void(INT32, INT32)> onMoved; /**< Triggered whenever widget position changes. */
 		Event<void(EditorWidgetContainer*)> onParentChanged; /**< Triggered whenever widget parent container changes. */
@@ -119,6 +140,18 @@ namespace bs
 		/**	Enables the widget making its previously hidden GUI contents visible. */
 		void _enable();
 
+		/** 
+		 * Checks does the widget need to be updated this frame. This is true if the widget was marked as dirty, has focus
+		 * or is updated continuously.
+		 */
+		bool _isDirty() const { return mIsDirty || mHasFocus || mContinuousUpdate; }
+
+		/** Clears the dirty flag. Should be called right before the widget is updated. */
+		void _clearDirty() { mIsDirty = false; }
+
+		/** Notifies the widget that its update was skipped this frame due to idle mode. */
+		void _notifyFrameSkipped() { mNumSkippedFrames++; }
+
 		/** @} */
 	protected:
 		friend class EditorWidgetManager;
@@ -155,6 +188,9 @@ namespace bs
 		GUIPanel* mContent = nullptr;
 		bool mHasFocus = false;
 		bool mIsActive = true;
+		bool mIsDirty = true;
+		bool mContinuousUpdate = false;
+		UINT64 mNumSkippedFrames = 0;
 	};
 
 	/** @} */
@@ -3,8 +3,10 @@
 #include "EditorWindow/BsEditorWidgetContainer.h"
 #include "GUI/BsGUITabbedTitleBar.h"
 #include "EditorWindow/BsEditorWidget.h"
+#include "EditorWindow/BsEditorWidgetProfiler.h"
 #include "GUI/BsDragAndDropManager.h"
 #include "EditorWindow/BsEditorWindow.h"
+#include "EditorWindow/BsEditorWindowManager.h"
 #include "GUI/BsGUIPanel.h"
 #include "GUI/BsGUIWidget.h"
 #include "Math/BsMath.h"
@@ -45,9 +47,21 @@ namespace bs
 
 	void EditorWidgetContainer::update()
 	{
+		bool idleMode = EditorWindowManager::instance().isIdleModeEnabled();
 		for (auto& widget : mWidgets)
 		{
+			if (idleMode && !widget.second->_isDirty())
+			{
+				widget.second->_notifyFrameSkipped();
+				continue;
+			}
+
+			widget.second->_clearDirty();
+
+			EditorWidgetProfiler& profiler = EditorWidgetProfiler::instance();
+			profiler.beginSample(widget.second, EditorWidgetSampleType::Update);
 			widget.second->update();
+			profiler.endSample(widget.second, EditorWidgetSampleType::Update);
 		}
 	}
 
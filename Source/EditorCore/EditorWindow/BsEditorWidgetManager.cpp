@@ -14,6 +14,7 @@
 #include "Managers/BsRenderWindowManager.h"
 #include "Math/BsVector2I.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Platform/BsPlatform.h"
 
 using namespace std::placeholders;
 
@@ -33,12 +34,19 @@ namespace bs
 
 		mOnFocusLostConn = RenderWindowManager::instance().onFocusLost.connect(std::bind(&EditorWidgetManager::onFocusLost, this, _1));
 		mOnFocusGainedConn = RenderWindowManager::instance().onFocusGained.connect(std::bind(&EditorWidgetManager::onFocusGained, this, _1));
+
+		mPointerMovedConn = gInput().onPointerMoved.connect(std::bind(&EditorWidgetManager::onPointerEvent, this, _1));
+		mPointerPressedConn = gInput().onPointerPressed.connect(std::bind(&EditorWidgetManager::onPointerEvent, this, _1));
+		mPointerReleasedConn = gInput().onPointerReleased.connect(std::bind(&EditorWidgetManager::onPointerEvent, this, _1));
 	}
 
 	EditorWidgetManager::~EditorWidgetManager()
 	{
 		mOnFocusLostConn.disconnect();
 		mOnFocusGainedConn.disconnect();
+		mPointerMovedConn.disconnect();
+		mPointerPressedConn.disconnect();
+		mPointerReleasedConn.disconnect();
 
 		UnorderedMap<String, EditorWidgetBase*> widgetsCopy = mActiveWidgets;
 
@@ -134,6 +142,9 @@ namespace bs
 		if(findIter != mActiveWidgets.end())
 			mActiveWidgets.erase(findIter);
 
+		if(mHoveredWidget == widget)
+			mHoveredWidget = nullptr;
+
 		for(auto iter = mSavedFocusedWidgets.begin(); iter != mSavedFocusedWidgets.end();)
 		{
 			if (iter->second == widget)
@@ -160,6 +171,64 @@ namespace bs
 			widget->close();
 	}
 
+	void EditorWidgetManager::_notifyFrameSkipped(EditorWindowBase* window)
+	{
+		for (auto& widget : mActiveWidgets)
+		{
+			if (widget.second->getParentWindow() == window)
+				widget.second->_notifyFrameSkipped();
+		}
+	}
+
+	void EditorWidgetManager::_markContinuousWidgetsDirty()
+	{
+		for (auto& widget : mActiveWidgets)
+		{
+			if (widget.second->getContinuousUpdate())
+				widget.second->markDirty();
+		}
+	}
+
+	void EditorWidgetManager::_markAllWidgetsDirty()
+	{
+		for (auto& widget : mActiveWidgets)
+			widget.second->markDirty();
+	}
+
+	void EditorWidgetManager::onPointerEvent(const PointerEvent& event)
+	{
+		EditorWidgetBase* hoveredWidget = nullptr;
+		for (auto& widgetData : mActiveWidgets)
+		{
+			EditorWidgetBase* widget = widgetData.second;
+			EditorWidgetContainer* parentContainer = widget->_getParent();
+			if (parentContainer == nullptr || parentContainer->getActiveWidget() != widget)
+				continue;
+
+			EditorWindowBase* parentWindow = parentContainer->getParentWindow();
+			if (!Platform::isPointOverWindow(*parentWindow->getRenderWindow(), event.screenPos))
+				continue;
+
+			Vector2I widgetPos = widget->screenToWidgetPos(event.screenPos);
+			if (widgetPos.x >= 0 && widgetPos.y >= 0
+				&& widgetPos.x < (INT32)widget->getWidth()
+				&& widgetPos.y < (INT32)widget->getHeight())
+			{
+				hoveredWidget = widget;
+				break;
+			}
+		}
+
+		if (hoveredWidget != nullptr)
+			hoveredWidget->markDirty();
+
+		// Widget the pointer just left needs to be updated as well, to clear any hover state
+		if (mHoveredWidget != hoveredWidget && mHoveredWidget != nullptr)
+			mHoveredWidget->markDirty();
+
+		mHoveredWidget = hoveredWidget;
+	}
+
 	EditorWidgetBase* EditorWidgetManager::create(const String& name, EditorWidgetContainer& parentContainer)
 	{
 		auto iterFind = mActiveWidgets.find(name);
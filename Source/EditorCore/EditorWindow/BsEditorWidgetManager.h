@@ -77,6 +77,21 @@ namespace bs
 		 */
 		static void preRegisterWidget(const String& name, std::function<EditorWidgetBase*(EditorWidgetContainer&)> createCallback);
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Notifies all widgets docked in the provided window that their update was skipped this frame. */
+		void _notifyFrameSkipped(EditorWindowBase* window);
+
+		/** Marks all widgets that are updated continuously as dirty, as well as their parent windows. */
+		void _markContinuousWidgetsDirty();
+
+		/** Marks all active widgets as dirty, as well as their parent windows. */
+		void _markAllWidgetsDirty();
+
+		/** @} */
+
 	private:
 		/**	Triggered whenever a window gains focus. */
 		void onFocusGained(const RenderWindow& window);
@@ -84,12 +99,20 @@ namespace bs
 		/**	Triggered whenever a window loses focus. */
 		void onFocusLost(const RenderWindow& window);
 
+		/** Triggered whenever the pointer moves or a pointer button is pressed. Marks the widgets it affects as dirty. */
+		void onPointerEvent(const PointerEvent& event);
+
 		UnorderedMap<String, EditorWidgetBase*> mActiveWidgets;
 		UnorderedMap<const RenderWindow*, EditorWidgetBase*> mSavedFocusedWidgets;
 		UnorderedMap<String, std::function<EditorWidgetBase*(EditorWidgetContainer&)>> mCreateCallbacks;
 
 		HEvent mOnFocusLostConn;
 		HEvent mOnFocusGainedConn;
+		HEvent mPointerMovedConn;
+		HEvent mPointerPressedConn;
+		HEvent mPointerReleasedConn;
+
+		EditorWidgetBase* mHoveredWidget = nullptr;
 
 		static Stack<std::pair<String, std::function<EditorWidgetBase*(EditorWidgetContainer&)>>> QueuedCreateCallbacks;
 	};
@@ -0,0 +1,232 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "EditorWindow/BsEditorWidgetProfiler.h"
+#include "EditorWindow/BsEditorWidget.h"
+#include "Utility/BsTime.h"
+
+namespace bs
+{
+	/** Names of the sample types, as displayed in the exported trace. */
+	static const char* SAMPLE_TYPE_NAMES[(UINT32)EditorWidgetSampleType::Count] = { "Update", "ManagedUpdate" };
+
+	struct EditorWidgetProfiler::SampleHistory
+	{
+		Sample samples[HISTORY_SIZE];
+		UINT32 next = 0;
+		UINT32 count = 0;
+		UINT64 activeStart = 0;
+		UINT64 activeGCStart = 0;
+	};
+
+	struct EditorWidgetProfiler::WidgetEntry
+	{
+		String name;
+		SampleHistory history[(UINT32)EditorWidgetSampleType::Count];
+	};
+
+	/** Escapes characters that are not allowed to appear in a JSON string. */
+	static String escapeJSON(const String& input)
+	{
+		static const char* HEX_DIGITS = "0123456789abcdef";
+
+		String output;
+		output.reserve(input.size());
+
+		for (auto& entry : input)
+		{
+			if (entry == '"' || entry == '\\')
+			{
+				output += '\\';
+				output += entry;
+			}
+			else if ((UINT8)entry < 0x20)
+			{
+				output += "\\u00";
+				output += HEX_DIGITS[((UINT8)entry >> 4) & 0xF];
+				output += HEX_DIGITS[(UINT8)entry & 0xF];
+			}
+			else
+				output += entry;
+		}
+
+		return output;
+	}
+
+	EditorWidgetProfiler::EditorWidgetProfiler()
+	{ }
+
+	EditorWidgetProfiler::~EditorWidgetProfiler()
+	{
+		clear();
+	}
+
+	void EditorWidgetProfiler::setEnabled(bool enabled)
+	{
+		if (mEnabled == enabled)
+			return;
+
+		mEnabled = enabled;
+
+		if (mEnabled)
+			mTimer.reset();
+		else
+			clear();
+	}
+
+	void EditorWidgetProfiler::beginSample(const EditorWidgetBase* widget, EditorWidgetSampleType type)
+	{
+		if (!mEnabled)
+			return;
+
+		WidgetEntry*& entry = mEntries[widget];
+		if (entry == nullptr)
+		{
+			entry = bs_new<WidgetEntry>();
+			entry->name = widget->getName();
+		}
+
+		SampleHistory& history = entry->history[(UINT32)type];
+		history.activeGCStart = mGCMemoryCallback ? mGCMemoryCallback() : 0;
+		history.activeStart = mTimer.getMicroseconds();
+	}
+
+	void EditorWidgetProfiler::endSample(const EditorWidgetBase* widget, EditorWidgetSampleType type)
+	{
+		if (!mEnabled)
+			return;
+
+		auto iterFind = mEntries.find(widget);
+		if (iterFind == mEntries.end())
+			return;
+
+		SampleHistory& history = iterFind->second->history[(UINT32)type];
+
+		Sample& sample = history.samples[history.next];
+		sample.frameIdx = gTime().getFrameIdx();
+		sample.start = history.activeStart;
+		sample.duration = mTimer.getMicroseconds() - history.activeStart;
+
+		UINT64 gcEnd = mGCMemoryCallback ? mGCMemoryCallback() : 0;
+		sample.gcAlloc = gcEnd > history.activeGCStart ? gcEnd - history.activeGCStart : 0;
+
+		history.next = (history.next + 1) % HISTORY_SIZE;
+		history.count = std::min(history.count + 1, HISTORY_SIZE);
+	}
+
+	Vector<EditorWidgetProfileStats> EditorWidgetProfiler::getStats() const
+	{
+		Vector<EditorWidgetProfileStats> output;
+		output.reserve(mEntries.size());
+
+		for (auto& entry : mEntries)
+		{
+			EditorWidgetProfileStats stats;
+			stats.name = entry.second->name;
+
+			for (UINT32 i = 0; i < (UINT32)EditorWidgetSampleType::Count; i++)
+			{
+				const SampleHistory& history = entry.second->history[i];
+
+				UINT64 total = 0;
+				UINT64 max = 0;
+				UINT64 totalGCAlloc = 0;
+				UINT64 maxGCAlloc = 0;
+				for (UINT32 j = 0; j < history.count; j++)
+				{
+					total += history.samples[j].duration;
+					max = std::max(max, history.samples[j].duration);
+
+					totalGCAlloc += history.samples[j].gcAlloc;
+					maxGCAlloc = std::max(maxGCAlloc, history.samples[j].gcAlloc);
+				}
+
+				if (history.count > 0)
+				{
+					UINT32 lastIdx = (history.next + HISTORY_SIZE - 1) % HISTORY_SIZE;
+
+					stats.last[i] = history.samples[lastIdx].duration / 1000.0f;
+					stats.average[i] = (total / (float)history.count) / 1000.0f;
+					stats.max[i] = max / 1000.0f;
+
+					stats.lastGCAlloc[i] = history.samples[lastIdx].gcAlloc;
+					stats.averageGCAlloc[i] = totalGCAlloc / history.count;
+					stats.maxGCAlloc[i] = maxGCAlloc;
+				}
+				else
+				{
+					stats.last[i] = 0.0f;
+					stats.average[i] = 0.0f;
+					stats.max[i] = 0.0f;
+
+					stats.lastGCAlloc[i] = 0;
+					stats.averageGCAlloc[i] = 0;
+					stats.maxGCAlloc[i] = 0;
+				}
+			}
+
+			output.push_back(stats);
+		}
+
+		std::sort(output.begin(), output.end(),
+			[](const EditorWidgetProfileStats& a, const EditorWidgetProfileStats& b)
+		{
+			return a.average[(UINT32)EditorWidgetSampleType::Update] > b.average[(UINT32)EditorWidgetSampleType::Update];
+		});
+
+		return output;
+	}
+
+	String EditorWidgetProfiler::exportChromeTrace() const
+	{
+		StringStream output;
+		output << "{\"traceEvents\":[";
+
+		bool isFirst = true;
+		for (auto& entry : mEntries)
+		{
+			String name = escapeJSON(entry.second->name);
+
+			for (UINT32 i = 0; i < (UINT32)EditorWidgetSampleType::Count; i++)
+			{
+				const SampleHistory& history = entry.second->history[i];
+
+				// Output oldest samples first
+				UINT32 firstIdx = (history.next + HISTORY_SIZE - history.count) % HISTORY_SIZE;
+				for (UINT32 j = 0; j < history.count; j++)
+				{
+					const Sample& sample = history.samples[(firstIdx + j) % HISTORY_SIZE];
+
+					if (!isFirst)
+						output << ",";
+
+					output << "{\"name\":\"" << name << "\",\"cat\":\"" << SAMPLE_TYPE_NAMES[i] << "\",\"ph\":\"X\","
+						<< "\"ts\":" << sample.start << ",\"dur\":" << sample.duration << ",\"pid\":0,\"tid\":0,"
+						<< "\"args\":{\"frame\":" << sample.frameIdx << ",\"gcAlloc\":" << sample.gcAlloc << "}}";
+
+					isFirst = false;
+				}
+			}
+		}
+
+		output << "],\"displayTimeUnit\":\"ms\"}";
+		return output.str();
+	}
+
+	void EditorWidgetProfiler::_notifyWidgetDestroyed(const EditorWidgetBase* widget)
+	{
+		auto iterFind = mEntries.find(widget);
+		if (iterFind == mEntries.end())
+			return;
+
+		bs_delete(iterFind->second);
+		mEntries.erase(iterFind);
+	}
+
+	void EditorWidgetProfiler::clear()
+	{
+		for (auto& entry : mEntries)
+			bs_delete(entry.second);
+
+		mEntries.clear();
+	}
+}
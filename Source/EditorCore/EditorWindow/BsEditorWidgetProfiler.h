@@ -0,0 +1,115 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	/** @addtogroup EditorWindow-Internal
+	 *  @{
+	 */
+
+	/** Types of per-widget samples recorded by EditorWidgetProfiler. */
+	enum class EditorWidgetSampleType
+	{
+		/** Total time spent in EditorWidgetBase::update(), including any managed callbacks. */
+		Update,
+		/** Time spent in the managed OnEditorUpdate() callback of script widgets. */
+		ManagedUpdate,
+		Count // Keep at end
+	};
+
+	/** 
+	 * Aggregated timings of a single widget over the recorded history, in milliseconds, as well as the amount of managed
+	 * memory allocated during the samples, in bytes.
+	 */
+	struct EditorWidgetProfileStats
+	{
+		String name;
+		float last[(UINT32)EditorWidgetSampleType::Count];
+		float average[(UINT32)EditorWidgetSampleType::Count];
+		float max[(UINT32)EditorWidgetSampleType::Count];
+		UINT64 lastGCAlloc[(UINT32)EditorWidgetSampleType::Count];
+		UINT64 averageGCAlloc[(UINT32)EditorWidgetSampleType::Count];
+		UINT64 maxGCAlloc[(UINT32)EditorWidgetSampleType::Count];
+	};
+
+	/**
+	 * Records how much CPU time each editor widget spends updating every frame. Keeps a rolling history of the last
+	 * HISTORY_SIZE frames for every open widget, which can be queried as aggregated statistics or exported in the Chrome
+	 * trace event format (viewable through chrome://tracing).
+	 *
+	 * @note	Disabled by default, in which case sampling methods return immediately.
+	 */
+	class BS_ED_EXPORT EditorWidgetProfiler : public Module<EditorWidgetProfiler>
+	{
+		/** Information about a single recorded sample. Times are in microseconds since profiler start-up. */
+		struct Sample
+		{
+			UINT64 frameIdx = 0;
+			UINT64 start = 0;
+			UINT64 duration = 0;
+			UINT64 gcAlloc = 0;
+		};
+
+		/** Ring buffer containing a history of samples of a single type. */
+		struct SampleHistory;
+
+		/** All samples recorded for a single widget. */
+		struct WidgetEntry;
+
+	public:
+		/** Number of frames to keep samples for. */
+		static constexpr UINT32 HISTORY_SIZE = 120;
+
+		EditorWidgetProfiler();
+		~EditorWidgetProfiler();
+
+		/** Enables or disables sample recording. Disabling the profiler clears all recorded history. */
+		void setEnabled(bool enabled);
+
+		/** Checks is the profiler currently recording samples. */
+		bool isEnabled() const { return mEnabled; }
+
+		/** Begins a sample of the provided type for the specified widget. Must be followed by endSample(). */
+		void beginSample(const EditorWidgetBase* widget, EditorWidgetSampleType type);
+
+		/** Ends a sample started with beginSample() and records it in the widget's history. */
+		void endSample(const EditorWidgetBase* widget, EditorWidgetSampleType type);
+
+		/** Returns aggregated timings for all widgets with recorded samples, sorted by average update time. */
+		Vector<EditorWidgetProfileStats> getStats() const;
+
+		/** Exports all recorded samples as a JSON string in the Chrome trace event format. */
+		String exportChromeTrace() const;
+
+		/** 
+		 * Sets a callback that returns the size of the managed heap currently in use, in bytes. When set, each sample
+		 * also records how much managed memory was allocated while it was active. Since the heap can shrink if a 
+		 * collection runs during a sample, the values are approximate and such samples report zero.
+		 */
+		void setGCMemoryCallback(std::function<UINT64()> callback) { mGCMemoryCallback = std::move(callback); }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Removes all history for the provided widget. Called by the widget when it's being destroyed. */
+		void _notifyWidgetDestroyed(const EditorWidgetBase* widget);
+
+		/** @} */
+	private:
+		/** Removes all recorded samples. */
+		void clear();
+
+		UnorderedMap<const EditorWidgetBase*, WidgetEntry*> mEntries;
+		Timer mTimer;
+		std::function<UINT64()> mGCMemoryCallback;
+		bool mEnabled = false;
+	};
+
+	/** @} */
+}
@@ -102,7 +102,11 @@ namespace bs
 		mWindowFrame = mSceneObject->addComponent<WindowFrameWidget>(!mIsModal, mCamera->_getCamera(), renderWindow.get(), BuiltinEditorResources::instance().getSkin());
 		mWindowFrame->setDepth(129);
 
-		mResizedConn = renderWindow->onResized.connect(std::bind(&EditorWindowBase::resized, this));
+		mResizedConn = renderWindow->onResized.connect([this]()
+		{
+			markDirty();
+			resized();
+		});
 	}
 
 	void EditorWindowBase::setPosition(INT32 x, INT32 y)
@@ -139,4 +143,27 @@ namespace bs
 	{
 		return mRenderWindow->getProperties().hasFocus;
 	}
+
+	bool EditorWindowBase::_isDirty() const
+	{
+		if (mIsDirty)
+			return true;
+
+		return hasFocus();
+	}
+
+	void EditorWindowBase::_setRedrawOnDemand(bool enabled)
+	{
+		if (mRedrawOnDemand == enabled)
+			return;
+
+		mRedrawOnDemand = enabled;
+		mCamera->_getCamera()->setFlag(CameraFlag::OnDemand, enabled);
+	}
+
+	void EditorWindowBase::_notifyNeedsRedraw()
+	{
+		if (mRedrawOnDemand)
+			mCamera->_getCamera()->notifyNeedsRedraw();
+	}
 }
\ No newline at end of file
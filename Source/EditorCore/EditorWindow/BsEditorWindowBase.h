@@ -63,6 +63,42 @@ namespace bs
 		/**	Checks whether the window currently has keyboard focus. */	
 		bool hasFocus() const;
 
+		/** 
+		 * Notifies the window that some of its contents changed and it needs to be updated and redrawn. When idle mode is
+		 * active windows that are not dirty will not be updated. 
+		 */
+		void markDirty() { mIsDirty = true; }
+
+		/** Returns the number of frames the window update was skipped due to idle mode. */
+		UINT64 getNumSkippedFrames() const { return mNumSkippedFrames; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** 
+		 * Checks does the window need to be updated this frame. This is true if the window or any of its widgets were
+		 * marked as dirty, or if the window has focus.
+		 */
+		bool _isDirty() const;
+
+		/** Clears the dirty flag. Should be called right before the window is updated. */
+		void _clearDirty() { mIsDirty = false; }
+
+		/** 
+		 * Determines should the window GUI only be redrawn when requested through _notifyNeedsRedraw(), instead of every
+		 * frame.
+		 */
+		void _setRedrawOnDemand(bool enabled);
+
+		/** Requests the window GUI to be redrawn this frame, if redraw on demand is enabled. */
+		void _notifyNeedsRedraw();
+
+		/** Notifies the window that its update was skipped this frame. */
+		void _notifyFrameSkipped() { mNumSkippedFrames++; }
+
+		/** @} */
+
 	protected:
 		EditorWindowBase(bool isModal = false, UINT32 width = 200, UINT32 height = 200);
 		EditorWindowBase(const SPtr<RenderWindow>& renderWindow);
@@ -83,6 +119,9 @@ namespace bs
 		GameObjectHandle<WindowFrameWidget> mWindowFrame;
 		bool mOwnsRenderWindow;
 		bool mIsModal;
+		bool mIsDirty = true;
+		bool mRedrawOnDemand = false;
+		UINT64 mNumSkippedFrames = 0;
 	private:
 		HEvent mResizedConn;
 	};
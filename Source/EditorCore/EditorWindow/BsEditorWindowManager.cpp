@@ -3,18 +3,32 @@
 #include "EditorWindow/BsEditorWindowManager.h"
 #include "EditorWindow/BsEditorWindow.h"
 #include "EditorWindow/BsMainEditorWindow.h"
+#include "EditorWindow/BsEditorWidgetManager.h"
 #include "RenderAPI/BsRenderWindow.h"
+#include "Input/BsInput.h"
+#include "Platform/BsPlatform.h"
+
+using namespace std::placeholders;
 
 namespace bs
 {
 	EditorWindowManager::EditorWindowManager()
 		:mMainWindow(nullptr)
 	{
-
+		mPointerMovedConn = gInput().onPointerMoved.connect(std::bind(&EditorWindowManager::onPointerEvent, this, _1));
+		mPointerPressedConn = gInput().onPointerPressed.connect(std::bind(&EditorWindowManager::onPointerEvent, this, _1));
+		mPointerReleasedConn = gInput().onPointerReleased.connect(std::bind(&EditorWindowManager::onPointerEvent, this, _1));
+		mPointerDoubleClickConn = gInput().onPointerDoubleClick.connect(
+			std::bind(&EditorWindowManager::onPointerEvent, this, _1));
 	}
 
 	EditorWindowManager::~EditorWindowManager()
 	{
+		mPointerMovedConn.disconnect();
+		mPointerPressedConn.disconnect();
+		mPointerReleasedConn.disconnect();
+		mPointerDoubleClickConn.disconnect();
+
 		while(mEditorWindows.size() > 0)
 			destroy(mEditorWindows[0]);
 
@@ -56,6 +70,9 @@ namespace bs
 		if(iterFind == end(mEditorWindows))
 			return;
 
+		if(mHoveredWindow == window)
+			mHoveredWindow = nullptr;
+
 		auto iterFind2 = std::find(begin(mScheduledForDestruction), end(mScheduledForDestruction), window);
 		
 		if(iterFind2 == end(mScheduledForDestruction))
@@ -96,12 +113,83 @@ namespace bs
 
 		// Make a copy since other editors might be opened/closed from editor update() methods
 		mEditorWindowsSnapshot = mEditorWindows; 
-		mMainWindow->update();
 
+		if (mIdleModeEnabled)
+			EditorWidgetManager::instance()._markContinuousWidgetsDirty();
+
+		bool anyUpdated = updateWindow(mMainWindow);
 		for (auto& window : mEditorWindowsSnapshot)
 		{
-			window->update();
+			if(updateWindow(window))
+				anyUpdated = true;
+		}
+
+		mIsIdle = !anyUpdated;
+	}
+
+	bool EditorWindowManager::updateWindow(EditorWindowBase* window)
+	{
+		// When idle, windows are only redrawn on frames they are updated on
+		window->_setRedrawOnDemand(mIdleModeEnabled);
+
+		if (mIdleModeEnabled && !window->_isDirty())
+		{
+			window->_notifyFrameSkipped();
+			EditorWidgetManager::instance()._notifyFrameSkipped(window);
+
+			return false;
+		}
+
+		window->_clearDirty();
+		window->_notifyNeedsRedraw();
+		window->update();
+
+		return true;
+	}
+
+	void EditorWindowManager::markAllDirty()
+	{
+		if (mMainWindow != nullptr)
+			mMainWindow->markDirty();
+
+		for (auto& window : mEditorWindows)
+			window->markDirty();
+
+		// Widget containers skip widgets that aren't dirty themselves, regardless of their parent window
+		if (EditorWidgetManager::isStarted())
+			EditorWidgetManager::instance()._markAllWidgetsDirty();
+	}
+
+	void EditorWindowManager::onPointerEvent(const PointerEvent& event)
+	{
+		EditorWindowBase* window = findWindowAt(event.screenPos);
+		if (window != nullptr)
+			window->markDirty();
+
+		// Window the pointer just left needs to be redrawn as well, to clear any hover state
+		if (mHoveredWindow != window && mHoveredWindow != nullptr)
+			mHoveredWindow->markDirty();
+
+		mHoveredWindow = window;
+	}
+
+	EditorWindowBase* EditorWindowManager::findWindowAt(const Vector2I& screenPos) const
+	{
+		for (auto& window : mEditorWindows)
+		{
+			SPtr<RenderWindow> renderWindow = window->getRenderWindow();
+			if (renderWindow != nullptr && Platform::isPointOverWindow(*renderWindow, screenPos))
+				return window;
 		}
+
+		if (mMainWindow != nullptr)
+		{
+			SPtr<RenderWindow> renderWindow = mMainWindow->getRenderWindow();
+			if (renderWindow != nullptr && Platform::isPointOverWindow(*renderWindow, screenPos))
+				return mMainWindow;
+		}
+
+		return nullptr;
 	}
 
 	bool EditorWindowManager::hasFocus() const
@@ -51,9 +51,48 @@ namespace bs
 
 		/** Checks if new editor windows should be created hidden. */
 		bool areNewWindowsHidden() const { return mNewWindowsHidden; }
+
+		/** 
+		 * Enables or disables idle mode. When enabled, windows that are not dirty (see EditorWindowBase::_isDirty) will
+		 * skip their update.
+		 */
+		void setIdleModeEnabled(bool enabled) { mIdleModeEnabled = enabled; }
+
+		/** Checks is idle mode enabled. See setIdleModeEnabled(). */
+		bool isIdleModeEnabled() const { return mIdleModeEnabled; }
+
+		/** Returns true if idle mode is enabled and all windows skipped their update during the last call to update(). */
+		bool isIdle() const { return mIsIdle; }
+
+		/** 
+		 * Marks all editor windows and the widgets docked in them as dirty, ensuring they get updated and redrawn on the
+		 * next update even if idle mode is active. Should be called when changes that can affect any window happen (e.g.
+		 * scene or selection changes).
+		 */
+		void markAllDirty();
 	protected:
+		/** 
+		 * Updates the provided window if it is dirty, or if idle mode is disabled. Returns true if the window was updated,
+		 * false if the update was skipped.
+		 */
+		bool updateWindow(EditorWindowBase* window);
+
+		/** Triggered whenever the pointer moves or a pointer button is pressed. Marks the windows it affects as dirty. */
+		void onPointerEvent(const PointerEvent& event);
+
+		/** Returns the editor window under the provided screen position, or null if none. */
+		EditorWindowBase* findWindowAt(const Vector2I& screenPos) const;
+
 		bool mNewWindowsHidden = true;
+		bool mIdleModeEnabled = false;
+		bool mIsIdle = false;
 		MainEditorWindow* mMainWindow;
+		EditorWindowBase* mHoveredWindow = nullptr;
+
+		HEvent mPointerMovedConn;
+		HEvent mPointerPressedConn;
+		HEvent mPointerReleasedConn;
+		HEvent mPointerDoubleClickConn;
 
 		Vector<EditorWindowBase*> mEditorWindows;
 		Vector<EditorWindowBase*> mScheduledForDestruction;
@@ -136,7 +136,7 @@ namespace bs
 		}
 	}
 
-	Vector2I GUIColorDistributionField::_getOptimalSize() const
+	Vector2I GUIColorDistributionField::calculateOptimalSize() const
 	{
 		Vector2I optimalsize = Vector2I::ZERO;
 
@@ -220,6 +220,8 @@ namespace bs
 
 		if (mMaxGradientField)
 			mMaxGradientField->setStyle(getSubStyleName(COLOR_GRADIENT_FIELD_STYLE_TYPE));
+
+		_markOptimalSizeDirty();
 	}
 
 	void GUIColorDistributionField::rebuild()
@@ -308,6 +310,13 @@ namespace bs
 
 		mLayout->addNewElement<GUIFixedSpace>(10);
 		mLayout->addElement(mDropDownButton);
+
+		registerChildField(mMinColorField);
+		registerChildField(mMaxColorField);
+		registerChildField(mMinGradientField);
+		registerChildField(mMaxGradientField);
+
+		_markOptimalSizeDirty();
 	}
 
 	const String& GUIColorDistributionField::getGUITypeName()
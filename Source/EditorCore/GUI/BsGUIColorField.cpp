@@ -33,7 +33,7 @@ namespace bs
 		mColor->setTint(color);
 	}
 
-	Vector2I GUIColorField::_getOptimalSize() const
+	Vector2I GUIColorField::calculateOptimalSize() const
 	{
 		Vector2I optimalsize = mColor->_getOptimalSize();
 
@@ -52,6 +52,8 @@ namespace bs
 			mLabel->setStyle(getSubStyleName(getLabelStyleType()));
 
 		mColor->setStyle(getSubStyleName(getColorInputStyleType()));
+
+		_markOptimalSizeDirty();
 	}
 
 	void GUIColorField::clicked()
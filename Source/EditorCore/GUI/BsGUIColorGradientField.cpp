@@ -40,7 +40,7 @@ namespace bs
 	}
 
 	template<class T, class TGUI, class TSELF>
-	Vector2I TGUIColorGradientField<T, TGUI, TSELF>::_getOptimalSize() const
+	Vector2I TGUIColorGradientField<T, TGUI, TSELF>::calculateOptimalSize() const
 	{
 		Vector2I optimalsize = mGradient->_getOptimalSize();
 
@@ -60,6 +60,8 @@ namespace bs
 			mLabel->setStyle(this->getSubStyleName(this->getLabelStyleType()));
 
 		mGradient->setStyle(this->getSubStyleName(GRADIENT_FIELD_STYLE_TYPE));
+
+		this->_markOptimalSizeDirty();
 	}
 
 	template<class T, class TGUI, class TSELF>
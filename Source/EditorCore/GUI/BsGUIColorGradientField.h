@@ -50,8 +50,8 @@ namespace bs
 		 *  @{
 		 */
 
-		/** @copydoc GUIElement::_getOptimalSize */
-		Vector2I _getOptimalSize() const override;
+		/** @copydoc GUIFieldBase::calculateOptimalSize */
+		Vector2I calculateOptimalSize() const override;
 
 		/** @} */
 
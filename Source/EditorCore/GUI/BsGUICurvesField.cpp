@@ -75,7 +75,7 @@ namespace bs
 		mCurves->setTint(color);
 	}
 
-	Vector2I GUICurvesField::_getOptimalSize() const
+	Vector2I GUICurvesField::calculateOptimalSize() const
 	{
 		Vector2I optimalsize = mCurves->_getOptimalSize();
 
@@ -94,6 +94,8 @@ namespace bs
 			mLabel->setStyle(getSubStyleName(getLabelStyleType()));
 
 		mCurves->setStyle(getSubStyleName(getCurveStyleType()));
+
+		_markOptimalSizeDirty();
 	}
 
 	void GUICurvesField::clicked()
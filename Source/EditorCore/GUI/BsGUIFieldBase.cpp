@@ -30,13 +30,46 @@ namespace bs
 	}
 
 	Vector2I GUIFieldBase::_getOptimalSize() const
+	{
+		// Label has a fixed width and immutable contents, so only the remaining contents can invalidate the cached size
+		if(mIsOptimalSizeDirty)
+		{
+			mOptimalSize = calculateOptimalSize();
+			mIsOptimalSizeDirty = false;
+		}
+
+		return mOptimalSize;
+	}
+
+	Vector2I GUIFieldBase::calculateOptimalSize() const
 	{
 		return GUILayoutUtility::calcOptimalSize(mLayout);
 	}
 
+	void GUIFieldBase::_markOptimalSizeDirty()
+	{
+		GUIFieldBase* field = this;
+		while(field != nullptr)
+		{
+			field->mIsOptimalSizeDirty = true;
+			field = field->mParentField;
+		}
+	}
+
+	void GUIFieldBase::registerChildField(GUIFieldBase* field)
+	{
+		if(field == nullptr)
+			return;
+
+		field->mParentField = this;
+		_markOptimalSizeDirty();
+	}
+
 	void GUIFieldBase::styleUpdated()
 	{
 		if (mLabel != nullptr)
 			mLabel->setStyle(getSubStyleName(getLabelStyleType()));
+
+		_markOptimalSizeDirty();
 	}
 }
\ No newline at end of file
@@ -36,13 +36,37 @@ namespace bs
 		/** @copydoc GUIElementContainer::_updateLayoutInternal */
 		void _updateLayoutInternal(const GUILayoutData& data) override;
 
-		/** @copydoc GUIElementContainer::_getOptimalSize */
-		Vector2I _getOptimalSize() const override;
+		/** 
+		 * @copydoc GUIElementContainer::_getOptimalSize 
+		 *
+		 * The optimal size is cached and only recalculated after the field's contents or style change. See
+		 * _markOptimalSizeDirty().
+		 */
+		Vector2I _getOptimalSize() const final;
+
+		/** 
+		 * Notifies the field that its optimal size needs to be recalculated the next time it is requested. This should be
+		 * called whenever field contents change in a way that might affect their size (e.g. input text, style or
+		 * the set of child elements). Notification is forwarded to the parent field, if any.
+		 */
+		void _markOptimalSizeDirty();
 
 		/** @} */
 	protected:
 		virtual ~GUIFieldBase() = default;
 
+		/** 
+		 * Calculates the optimal size of the field's contents. Called by _getOptimalSize() whenever the cached size
+		 * is out of date.
+		 */
+		virtual Vector2I calculateOptimalSize() const;
+
+		/** 
+		 * Registers a field as a child of this field. Whenever the child field's optimal size changes the cached optimal
+		 * size of this field will be invalidated as well.
+		 */
+		void registerChildField(GUIFieldBase* field);
+
 		/** @copydoc GUIElementContainer::styleUpdated */
 		void styleUpdated() override;
 
@@ -50,6 +74,12 @@ namespace bs
 
 		GUILayout* mLayout;
 		GUILabel* mLabel;
+
+	private:
+		GUIFieldBase* mParentField = nullptr;
+
+		mutable Vector2I mOptimalSize;
+		mutable bool mIsOptimalSizeDirty = true;
 	};
 
 	/**	Templated GUI field class that provides common methods needed for constructing an editor field. */
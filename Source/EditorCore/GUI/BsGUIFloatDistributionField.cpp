@@ -296,7 +296,7 @@ namespace bs
 	}
 
 	template<class T, class SELF>
-	Vector2I TGUIDistributionField<T, SELF>::_getOptimalSize() const
+	Vector2I TGUIDistributionField<T, SELF>::calculateOptimalSize() const
 	{
 		Vector2I optimalsize = Vector2I::ZERO;
 
@@ -377,6 +377,8 @@ namespace bs
 			if (mCurveDisplay[i])
 				mCurveDisplay[i]->setStyle(this->getSubStyleName(CURVES_FIELD_STYLE_TYPES[i]));
 		}
+
+		this->_markOptimalSizeDirty();
 	}
 
 	template<class T, class SELF>
@@ -546,6 +548,14 @@ namespace bs
 
 		this->mLayout->template addNewElement<GUIFixedSpace>(10);
 		this->mLayout->addElement(mDropDownButton);
+
+		this->registerChildField(mMinInput);
+		this->registerChildField(mMaxInput);
+
+		for(int i = 0; i < NumComponents; i++)
+			this->registerChildField(mCurveDisplay[i]);
+
+		this->_markOptimalSizeDirty();
 	}
 
 	template class BS_ED_EXPORT TGUIDistributionField<float, GUIFloatDistributionField>;
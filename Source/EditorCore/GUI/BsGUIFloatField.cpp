@@ -193,10 +193,13 @@ namespace bs
 			mLabel->setStyle(getSubStyleName(getLabelStyleType()));
 
 		mInputBox->setStyle(getSubStyleName(getInputStyleType()));
+
+		_markOptimalSizeDirty();
 	}
 
 	void GUIFloatField::valueChanged(const String& newValue)
 	{
+		_markOptimalSizeDirty();
 		_setValue(parseFloat(newValue), true);
 	}
 
@@ -230,7 +233,10 @@ namespace bs
 		// updates back to "0" effectively making "." unusable
 		float curValue = parseFloat(mInputBox->getText());
 		if (value != curValue)
+		{
 			mInputBox->setText(toString(value));
+			_markOptimalSizeDirty();
+		}
 	}
 
 	float GUIFloatField::applyRangeAndStep(float value) const
@@ -152,6 +152,8 @@ namespace bs
 			mLabel->setStyle(getSubStyleName(getLabelStyleType()));
 
 		mInputBox->setStyle(getSubStyleName(getInputStyleType()));
+
+		_markOptimalSizeDirty();
 	}
 
 	INT32 GUIIntField::getValue() const
@@ -214,6 +216,7 @@ namespace bs
 
 	void GUIIntField::valueChanged(const String& newValue)
 	{
+		_markOptimalSizeDirty();
 		_setValue(parseINT32(newValue), true);
 	}
 
@@ -245,7 +248,10 @@ namespace bs
 		// updates back to "0" effectively making "." unusable
 		float curValue = parseFloat(mInputBox->getText());
 		if (value != curValue)
+		{
 			mInputBox->setText(toString(value));
+			_markOptimalSizeDirty();
+		}
 	}
 
 	INT32 GUIIntField::applyRangeAndStep(INT32 value) const
@@ -44,6 +44,7 @@ namespace bs
 
 		mRootElement.mFullPath = rootEntry->path;
 		mRootElement.mElementName = mRootElement.mFullPath.getTail();
+		mElementLookup[getLookupKey(mRootElement.mFullPath)] = &mRootElement;
 
 		expandElement(&mRootElement);
 
@@ -54,10 +55,11 @@ namespace bs
 	{
 		clearDropTarget();
 
-		for(auto& child : mRootElement.mChildren)
-			deleteTreeElement((ResourceTreeElement*)&child);
+		while(!mRootElement.mChildren.empty())
+			deleteTreeElement(static_cast<ResourceTreeElement*>(mRootElement.mChildren.back()));
 
-		mRootElement.mChildren.clear();
+		mElementLookup.clear();
+		mDirtySortedIndices.clear();
 
 		ResourceTreeViewLocator::_provide(nullptr);
 	}
@@ -81,6 +83,9 @@ namespace bs
 
 	void GUIResourceTreeView::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		// Layout orders the children by their sorted indices
+		flushSortedIndices();
+
 		GUITreeView::_updateLayoutInternal(data);
 
 		if(mDropTarget != nullptr)
@@ -89,7 +94,8 @@ namespace bs
 
 	void GUIResourceTreeView::updateTreeElementHierarchy()
 	{
-		// Do nothing, updates are handled via callbacks
+		// Hierarchy updates are handled via callbacks, only the sorted indices they invalidated need refreshing
+		flushSortedIndices();
 	}
 
 	void GUIResourceTreeView::renameTreeElement(GUITreeView::TreeElement* element, const String& name)
@@ -141,8 +147,6 @@ namespace bs
 					if(child->type == ProjectLibrary::LibraryEntryType::Directory)
 						todo.push(StackElem(child.get(), newChild));
 				}
-
-				sortTreeElement(curElem.treeElem);
 			}
 		}
 	}
@@ -153,11 +157,22 @@ namespace bs
 		newChild->mParent = parent;
 		newChild->mName = fullPath.getTail();
 		newChild->mFullPath = fullPath;
-		newChild->mSortedIdx = (UINT32)parent->mChildren.size();
 		newChild->mIsVisible = parent->mIsVisible && parent->mIsExpanded;
 		newChild->mElementName = fullPath.getTail();
 
-		parent->mChildren.push_back(newChild);
+		// Children are always kept sorted by name, so we can find the insertion point with a binary search
+		auto cmp = [](const String& name, const TreeElement* elem)
+		{
+			return name.compare(elem->mName) < 0;
+		};
+
+		auto iterInsert = std::upper_bound(parent->mChildren.begin(), parent->mChildren.end(), newChild->mName, cmp);
+		UINT32 insertIdx = (UINT32)(iterInsert - parent->mChildren.begin());
+
+		parent->mChildren.insert(iterInsert, newChild);
+		markSortedIndicesDirty(parent, insertIdx);
+
+		mElementLookup[getLookupKey(fullPath)] = newChild;
 
 		updateElementGUI(parent);
 		updateElementGUI(newChild);
@@ -169,10 +184,9 @@ namespace bs
 	{
 		closeTemporarilyExpandedElements(); // In case this element is one of them
 
-		for(auto& child : element->mChildren)
-			deleteTreeElement((ResourceTreeElement*)child);
-
-		element->mChildren.clear();
+		// Delete from the back so that removal from the parent doesn't need to shift any siblings
+		while(!element->mChildren.empty())
+			deleteTreeElement(static_cast<ResourceTreeElement*>(element->mChildren.back()));
 
 		if (element->mIsHighlighted)
 			clearPing();
@@ -182,36 +196,74 @@ namespace bs
 
 		if(element->mParent != nullptr)
 		{
-			auto iterFind = std::find(element->mParent->mChildren.begin(), element->mParent->mChildren.end(), element);
-			if(iterFind != element->mParent->mChildren.end())
-				element->mParent->mChildren.erase(iterFind);
+			ResourceTreeElement* parent = static_cast<ResourceTreeElement*>(element->mParent);
+
+			// Sorted indices might be out of date until the batch is flushed, so find the element by its name
+			auto cmp = [](const TreeElement* elem, const String& name)
+			{
+				return elem->mName.compare(name) < 0;
+			};
 
-			sortTreeElement(static_cast<ResourceTreeElement*>(element->mParent));
-			updateElementGUI(element->mParent);
+			auto iterFind = std::lower_bound(parent->mChildren.begin(), parent->mChildren.end(), element->mName, cmp);
+			while(iterFind != parent->mChildren.end() && *iterFind != element && (*iterFind)->mName == element->mName)
+				++iterFind;
+
+			if(iterFind != parent->mChildren.end() && *iterFind == element)
+			{
+				UINT32 removedIdx = (UINT32)(iterFind - parent->mChildren.begin());
+
+				parent->mChildren.erase(iterFind);
+				markSortedIndicesDirty(parent, removedIdx);
+			}
+
+			updateElementGUI(parent);
 		}
 
+		mDirtySortedIndices.erase(element);
+
 		if(&mRootElement != element)
+		{
+			auto iterFind = mElementLookup.find(getLookupKey(element->mFullPath));
+			if(iterFind != mElementLookup.end() && iterFind->second == element)
+				mElementLookup.erase(iterFind);
+
 			bs_delete(element);
+		}
 	}
 
-	void GUIResourceTreeView::sortTreeElement(ResourceTreeElement* element)
+	void GUIResourceTreeView::markSortedIndicesDirty(ResourceTreeElement* element, UINT32 startIdx)
 	{
-		auto cmp = [&] (const TreeElement* a, const TreeElement* b)
-		{
-			return a->mName.compare(b->mName) < 0;
-		};
-
-		std::sort(element->mChildren.begin(), element->mChildren.end(), cmp);
+		auto iterFind = mDirtySortedIndices.find(element);
+		if(iterFind != mDirtySortedIndices.end())
+			iterFind->second = std::min(iterFind->second, startIdx);
+		else
+			mDirtySortedIndices[element] = startIdx;
+	}
 
-		UINT32 idx = 0;
-		for(auto& child : element->mChildren)
+	void GUIResourceTreeView::flushSortedIndices()
+	{
+		for(auto& entry : mDirtySortedIndices)
 		{
-			child->mSortedIdx = idx;
-			idx++;
+			ResourceTreeElement* element = entry.first;
+
+			UINT32 numChildren = (UINT32)element->mChildren.size();
+			for(UINT32 i = entry.second; i < numChildren; i++)
+				element->mChildren[i]->mSortedIdx = i;
 		}
+
+		mDirtySortedIndices.clear();
 	}
 
 	GUIResourceTreeView::ResourceTreeElement* GUIResourceTreeView::findTreeElement(const Path& fullPath)
+	{
+		auto iterFind = mElementLookup.find(getLookupKey(fullPath));
+		if(iterFind != mElementLookup.end())
+			return iterFind->second;
+
+		return findTreeElementSlow(fullPath);
+	}
+
+	GUIResourceTreeView::ResourceTreeElement* GUIResourceTreeView::findTreeElementSlow(const Path& fullPath)
 	{
 		if (!mRootElement.mFullPath.includes(fullPath))
 			return nullptr;
@@ -252,15 +304,31 @@ namespace bs
 		return nullptr;
 	}
 
+	String GUIResourceTreeView::getLookupKey(const Path& fullPath)
+	{
+		String key = fullPath.toString();
+		while (!key.empty() && (key.back() == '/' || key.back() == '\\'))
+			key.pop_back();
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		StringUtil::toLowerCase(key);
+#endif
+
+		return key;
+	}
+
 	void GUIResourceTreeView::entryAdded(const Path& path)
 	{
 		Path parentPath = path.getParent();
 
 		ResourceTreeElement* parentElement = findTreeElement(parentPath);
-		assert(parentElement != nullptr);
+		if(parentElement == nullptr)
+		{
+			BS_LOG(Warning, Editor, "Cannot find the resource tree element for the parent of: " + path.toString());
+			return;
+		}
 
 		ResourceTreeElement* newElement = addTreeElement(parentElement, path);
-		sortTreeElement(parentElement);
 
 		ProjectLibrary::LibraryEntry* libEntry = gProjectLibrary().findEntry(path).get();
 		
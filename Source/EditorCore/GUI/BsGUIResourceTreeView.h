@@ -115,6 +115,9 @@ namespace bs
 		HEvent mDropTargetLeaveConn;
 		HEvent mDropTargetDroppedConn;
 
+		UnorderedMap<String, ResourceTreeElement*> mElementLookup;
+		UnorderedMap<ResourceTreeElement*, UINT32> mDirtySortedIndices;
+
 		GUIResourceTreeView(const String& backgroundStyle, const String& elementBtnStyle, const String& foldoutBtnStyle, 
 			const String& highlightBackgroundStyle, const String& selectionBackgroundStyle, const String& editBoxStyle,
 			const String& dragHighlightStyle, const String& dragSepHighlightStyle, const GUIDimensions& dimensions);
@@ -165,22 +168,45 @@ namespace bs
 		void updateFromProjectLibraryEntry(ResourceTreeElement* treeElement, const ProjectLibrary::LibraryEntry* libraryEntry);
 
 		/**
-		 * Creates a new tree view entry.
+		 * Creates a new tree view entry and inserts it at its sorted position among its siblings. Other siblings are not
+		 * re-sorted.
 		 *
 		 * @param[in]	parent		Parent tree view entry to create the new one for.
 		 * @param[in]	fullPath	Absolute path to the new tree entry.
 		 */
 		ResourceTreeElement* addTreeElement(ResourceTreeElement* parent, const Path& fullPath);
 
-		/**	Deletes the provided tree element. */
+		/**	Deletes the provided tree element, and all of its children. */
 		void deleteTreeElement(ResourceTreeElement* element);
 
-		/**	Sorts the children of the provided tree element by name. */
-		void sortTreeElement(ResourceTreeElement* element);
+		/** 
+		 * Notes that the sorted indices of the children of the provided tree element, starting at the specified
+		 * index, no longer match their position. Indices are refreshed in flushSortedIndices(), so a batch of
+		 * additions or removals under the same parent (e.g. when deleting a folder) only re-indexes the siblings once.
+		 */
+		void markSortedIndicesDirty(ResourceTreeElement* element, UINT32 startIdx);
+
+		/** 
+		 * Updates the sorted indices of all children marked through markSortedIndicesDirty(). Children are expected to
+		 * already be in sorted order.
+		 */
+		void flushSortedIndices();
 
 		/** Attempts to find a tree element with the specified path. Returns null if one cannot be found. */
 		ResourceTreeElement* findTreeElement(const Path& fullPath);
 
+		/** 
+		 * Finds a tree element with the specified path by walking the tree from the root. Used when the element lookup
+		 * doesn't contain the path. Returns null if one cannot be found.
+		 */
+		ResourceTreeElement* findTreeElementSlow(const Path& fullPath);
+
+		/** 
+		 * Converts a path into a key for the element lookup. Keys don't depend on whether the path is in file or directory
+		 * form, and are case insensitive on platforms with case insensitive paths.
+		 */
+		static String getLookupKey(const Path& fullPath);
+
 		/**	Called whenever a new entry is added to the project library. */
 		void entryAdded(const Path& path); 
 
@@ -288,6 +288,29 @@ namespace bs
 		onModified();
 	}
 
+	void GUISceneTreeView::deleteTreeElements(const Vector<TreeElement*>& elements)
+	{
+		if (elements.size() == 1)
+		{
+			deleteTreeElement(elements[0]);
+			return;
+		}
+
+		Vector<HSceneObject> sceneObjects;
+		for (auto& element : elements)
+		{
+			SceneTreeElement* sceneTreeElement = static_cast<SceneTreeElement*>(element);
+			sceneObjects.push_back(sceneTreeElement->mSceneObject);
+		}
+
+		if (sceneObjects.empty())
+			return;
+
+		CmdDeleteSO::execute(sceneObjects, "Deleted " + toString((UINT32)sceneObjects.size()) + " elements");
+
+		onModified();
+	}
+
 	void GUISceneTreeView::deleteTreeElementInternal(GUITreeView::TreeElement* element)
 	{
 		closeTemporarilyExpandedElements(); // In case this element is one of them
@@ -680,23 +703,17 @@ namespace bs
 
 	void GUISceneTreeView::cleanDuplicates(Vector<HSceneObject>& objects)
 	{
-		auto isChildOf = [&](const HSceneObject& parent, const HSceneObject& child)
-		{
-			HSceneObject elem = child;
-
-			while (elem != nullptr && elem != parent)
-				elem = elem->getParent();
-
-			return elem == parent;
-		};
+		UnorderedSet<UINT64> objectIds;
+		for (auto& object : objects)
+			objectIds.insert(object->getInstanceId());
 
 		Vector<HSceneObject> cleanList;
-		for (UINT32 i = 0; i < (UINT32)objects.size(); i++)
+		for (auto& object : objects)
 		{
 			bool foundParent = false;
-			for (UINT32 j = 0; j < (UINT32)objects.size(); j++)
+			for (HSceneObject parent = object->getParent(); parent != nullptr; parent = parent->getParent())
 			{
-				if (i != j && isChildOf(objects[j], objects[i]))
+				if (objectIds.find(parent->getInstanceId()) != objectIds.end())
 				{
 					foundParent = true;
 					break;
@@ -704,7 +721,7 @@ namespace bs
 			}
 
 			if (!foundParent)
-				cleanList.push_back(objects[i]);
+				cleanList.push_back(object);
 		}
 
 		objects = cleanList;
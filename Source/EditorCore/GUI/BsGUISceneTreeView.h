@@ -175,6 +175,9 @@ namespace bs
 		/** @copydoc GUITreeView::deleteTreeElement */
 		void deleteTreeElement(TreeElement* element) override;
 
+		/** @copydoc GUITreeView::deleteTreeElements */
+		void deleteTreeElements(const Vector<TreeElement*>& elements) override;
+
 		/** @copydoc GUITreeView::acceptDragAndDrop */
 		bool acceptDragAndDrop() const override;
 
@@ -57,7 +57,11 @@ namespace bs
 		// field updates back to "0" effectively making "." unusable
 		float curValue = parseFloat(mInputBox->getText());
 		if (clampedValue != curValue)
+		{
 			mInputBox->setText(toString(clampedValue));
+			_markOptimalSizeDirty();
+		}
+
 		return clampedValue;
 	}
 
@@ -112,10 +116,13 @@ namespace bs
 
 		mSlider->setStyle(getSubStyleName(getSliderStyleType()));
 		mInputBox->setStyle(getSubStyleName(getInputStyleType()));
+
+		_markOptimalSizeDirty();
 	}
 
 	void GUISliderField::inputBoxValueChanging(const String& newValue) 
 	{
+		_markOptimalSizeDirty();
 		inputBoxValueChanged(false);
 	}
 
@@ -134,6 +141,7 @@ namespace bs
 		else if (mInputBox->getText().empty() && confirmed) //Avoid leaving label blank
 		{
 			mInputBox->setText("0");
+			_markOptimalSizeDirty();
 		}
 	}
 
@@ -46,6 +46,8 @@ namespace bs
 			mLabel->setStyle(getSubStyleName(getLabelStyleType()));
 
 		mToggle->setStyle(getSubStyleName(getToggleStyleType()));
+
+		_markOptimalSizeDirty();
 	}
 
 	void GUIToggleField::valueChanged(bool newValue)
@@ -576,28 +576,19 @@ namespace bs
 	{
 		if (isSelectionActive())
 		{
-			auto isChildOf = [&](const TreeElement* parent, const TreeElement* child)
-			{
-				const TreeElement* elem = child;
-
-				while (elem != nullptr && elem != parent)
-					elem = elem->mParent;
-
-				return elem == parent;
-			};
+			UnorderedSet<TreeElement*> selectedElements;
+			for (auto& selectedElement : mSelectedElements)
+				selectedElements.insert(selectedElement.element);
 
 			// Ensure we don't unnecessarily try to delete children if their
 			// parent is getting deleted anyway
 			Vector<TreeElement*> elementsToDelete;
-			for (UINT32 i = 0; i < (UINT32)mSelectedElements.size(); i++)
+			for (auto& selectedElement : mSelectedElements)
 			{
 				bool hasDeletedParent = false;
-				for (UINT32 j = 0; j < (UINT32)mSelectedElements.size(); j++)
+				for (TreeElement* parent = selectedElement.element->mParent; parent != nullptr; parent = parent->mParent)
 				{
-					if (i == j)
-						continue;
-
-					if (isChildOf(mSelectedElements[j].element, mSelectedElements[i].element))
+					if (selectedElements.find(parent) != selectedElements.end())
 					{
 						hasDeletedParent = true;
 						break;
@@ -605,17 +596,22 @@ namespace bs
 				}
 
 				if (!hasDeletedParent)
-					elementsToDelete.push_back(mSelectedElements[i].element);
+					elementsToDelete.push_back(selectedElement.element);
 			}
 
 			clearPing();
 			unselectAll();
 
-			for (auto& elem : elementsToDelete)
-				deleteTreeElement(elem);
+			deleteTreeElements(elementsToDelete);
 		}
 	}
 
+	void GUITreeView::deleteTreeElements(const Vector<TreeElement*>& elements)
+	{
+		for (auto& element : elements)
+			deleteTreeElement(element);
+	}
+
 	void GUITreeView::ping(TreeElement* element)
 	{
 		clearPing();
@@ -193,6 +193,12 @@ namespace bs
 		/**	Deletes the content associated with the provided tree element. */
 		virtual void deleteTreeElement(TreeElement* element) = 0;
 
+		/**
+		 * Deletes the content associated with all of the provided tree elements. By default calls deleteTreeElement() for
+		 * each element, implementations can override it to delete all the elements in a single operation.
+		 */
+		virtual void deleteTreeElements(const Vector<TreeElement*>& elements);
+
 		/**	Checks whether the tree view can accept the currently active drag and drop operation. */
 		virtual bool acceptDragAndDrop() const = 0;
 
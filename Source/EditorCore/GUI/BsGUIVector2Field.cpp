@@ -29,6 +29,9 @@ namespace bs
 		mFieldX->onFocusChanged.connect([this](bool val) { onComponentFocusChanged(val, VectorComponent::X); });
 		mFieldY->onFocusChanged.connect([this](bool val) { onComponentFocusChanged(val, VectorComponent::Y); });
 
+		registerChildField(mFieldX);
+		registerChildField(mFieldY);
+
 		mLayout->addElement(mFieldX);
 		mLayout->addNewElement<GUIFixedSpace>(5);
 		mLayout->addElement(mFieldY);
@@ -93,6 +96,8 @@ namespace bs
 
 		mFieldX->setStyle(getSubStyleName(X_FIELD_STYLE_TYPE));
 		mFieldY->setStyle(getSubStyleName(Y_FIELD_STYLE_TYPE));
+
+		_markOptimalSizeDirty();
 	}
 
 	const String& GUIVector2Field::getGUITypeName()
@@ -33,6 +33,10 @@ namespace bs
 		mFieldY->onFocusChanged.connect([this](bool val) { onComponentFocusChanged(val, VectorComponent::Y); });
 		mFieldZ->onFocusChanged.connect([this](bool val) { onComponentFocusChanged(val, VectorComponent::Z); });
 
+		registerChildField(mFieldX);
+		registerChildField(mFieldY);
+		registerChildField(mFieldZ);
+
 		mLayout->addElement(mFieldX);
 		mLayout->addNewElement<GUIFixedSpace>(5);
 		mLayout->addElement(mFieldY);
@@ -91,6 +95,8 @@ namespace bs
 		mFieldX->setStyle(getSubStyleName(X_FIELD_STYLE_TYPE));
 		mFieldY->setStyle(getSubStyleName(Y_FIELD_STYLE_TYPE));
 		mFieldZ->setStyle(getSubStyleName(Z_FIELD_STYLE_TYPE));
+
+		_markOptimalSizeDirty();
 	}
 
 	void GUIVector3Field::valueChanged(float newValue, VectorComponent component)
@@ -37,6 +37,11 @@ namespace bs
 		mFieldZ->onFocusChanged.connect([this](bool val) { onComponentFocusChanged(val, VectorComponent::Z); });
 		mFieldW->onFocusChanged.connect([this](bool val) { onComponentFocusChanged(val, VectorComponent::W); });
 
+		registerChildField(mFieldX);
+		registerChildField(mFieldY);
+		registerChildField(mFieldZ);
+		registerChildField(mFieldW);
+
 		mLayout->removeElement(mLabel);
 
 		GUILayout* layout = mLayout->addNewElement<GUILayoutY>();
@@ -110,6 +115,8 @@ namespace bs
 		mFieldY->setStyle(getSubStyleName(Y_FIELD_STYLE_TYPE));
 		mFieldZ->setStyle(getSubStyleName(Z_FIELD_STYLE_TYPE));
 		mFieldW->setStyle(getSubStyleName(W_FIELD_STYLE_TYPE));
+
+		_markOptimalSizeDirty();
 	}
 
 	void GUIVector4Field::valueChanged(float newValue, VectorComponent component)
@@ -18,8 +18,12 @@ namespace bs
 	{
 		if (mFixedScale)
 		{
-			mDistanceScale = HandleManager::instance().getHandleSize(camera, mPosition);
-			mTransformDirty = true;
+			float distanceScale = HandleManager::instance().getHandleSize(camera, mPosition);
+			if (distanceScale != mDistanceScale)
+			{
+				mDistanceScale = distanceScale;
+				mTransformDirty = true;
+			}
 		}
 	}
 
@@ -62,17 +66,40 @@ namespace bs
 		return mTransformInv;
 	}
 
+	bool HandleSlider::getBounds(Sphere& bounds) const
+	{
+		if (!mHasBounds)
+			return false;
+
+		if (mTransformDirty)
+			updateCachedTransform();
+
+		bounds = mWorldBounds;
+		return true;
+	}
+
+	void HandleSlider::setLocalBounds(const Sphere& bounds)
+	{
+		mLocalBounds = bounds;
+		mHasBounds = true;
+		mTransformDirty = true;
+	}
+
 	void HandleSlider::updateCachedTransform() const
 	{
+		Vector3 scale = mScale;
 		if (mFixedScale)
+			scale *= mDistanceScale;
+
+		mTransform.setTRS(mPosition, mRotation, scale);
+		mTransformInv.setInverseTRS(mPosition, mRotation, scale);
+
+		if (mHasBounds)
 		{
-			mTransform.setTRS(mPosition, mRotation, mScale * mDistanceScale);
-			mTransformInv.setInverseTRS(mPosition, mRotation, mScale * mDistanceScale);
-		}
-		else
-		{
-			mTransform.setTRS(mPosition, mRotation, mScale);
-			mTransformInv.setInverseTRS(mPosition, mRotation, mScale);
+			float maxScale = std::max(std::max(Math::abs(scale.x), Math::abs(scale.y)), Math::abs(scale.z));
+
+			mWorldBounds = Sphere(mTransform.multiplyAffine(mLocalBounds.getCenter()), 
+				mLocalBounds.getRadius() * maxScale);
 		}
 
 		mTransformDirty = false;
@@ -6,6 +6,7 @@
 #include "Math/BsVector2I.h"
 #include "Math/BsMatrix4.h"
 #include "Math/BsQuaternion.h"
+#include "Math/BsSphere.h"
 
 namespace bs
 {
@@ -101,6 +102,12 @@ namespace bs
 		/**	Checks whether the slider can be interacted with or not. */
 		bool getEnabled() const { return mEnabled; }
 
+		/** 
+		 * Returns a world space sphere enclosing the slider geometry, usable for quickly rejecting intersection tests.
+		 * Returns false if the slider doesn't provide bounds, in which case intersects() must always be called.
+		 */
+		bool getBounds(Sphere& bounds) const;
+
 	protected:
 		friend class HandleSliderManager;
 
@@ -133,6 +140,12 @@ namespace bs
 		/**	Updates the internal transform from the stored position, rotation and scale values. */
 		void updateCachedTransform() const;
 
+		/** 
+		 * Sets a sphere enclosing the slider geometry, in slider local space. Should be called by implementations whose
+		 * intersects() tests geometry in the space defined by getTransform().
+		 */
+		void setLocalBounds(const Sphere& bounds);
+
 		/**
 		 * Calculates amount of movement along the provided ray depending on pointer movement.
 		 *
@@ -162,6 +175,10 @@ namespace bs
 		mutable bool mTransformDirty;
 		mutable Matrix4 mTransform;
 		mutable Matrix4 mTransformInv;
+
+		bool mHasBounds = false;
+		Sphere mLocalBounds;
+		mutable Sphere mWorldBounds;
 	};
 
 	/** @} */
@@ -17,6 +17,7 @@ namespace bs
 		, mStartPosition(BsZero), mDelta(0.0f)
 	{
 		mCollider = Torus(normal, radius, TORUS_RADIUS);
+		setLocalBounds(Sphere(Vector3::ZERO, radius + TORUS_RADIUS));
 
 		HandleSliderManager& sliderManager = HandleManager::instance().getSliderManager();
 		sliderManager._registerSlider(this);
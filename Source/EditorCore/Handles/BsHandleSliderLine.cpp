@@ -26,6 +26,9 @@ namespace bs
 		mCapsuleCollider = Capsule(LineSegment3(start, end), CAPSULE_RADIUS);
 		mSphereCollider = Sphere(sphereCenter, SPHERE_RADIUS);
 
+		float halfLength = std::max(0.0f, length) * 0.5f;
+		setLocalBounds(Sphere(mDirection * halfLength, halfLength + std::max(CAPSULE_RADIUS, SPHERE_RADIUS)));
+
 		HandleSliderManager& sliderManager = HandleManager::instance().getSliderManager();
 		sliderManager._registerSlider(this);
 	}
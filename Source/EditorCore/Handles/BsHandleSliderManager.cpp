@@ -4,6 +4,7 @@
 #include "Utility/BsBuiltinEditorResources.h"
 #include "Components/BsCCamera.h"
 #include "Handles/BsHandleSlider.h"
+#include "Math/BsRay.h"
 
 using namespace std::placeholders;
 
@@ -11,11 +12,13 @@ namespace bs
 {
 	void HandleSliderManager::update(const SPtr<Camera>& camera, const Vector2I& inputPos, const Vector2I& inputDelta)
 	{
-		for (auto& slider : mSliders)
+		UINT64 cameraLayers = camera->getLayers();
+		for (auto& entry : mSlidersPerLayer)
 		{
-			bool layerMatches = (camera->getLayers() & slider->getLayer()) != 0;
+			if ((cameraLayers & entry.first) == 0)
+				continue;
 
-			if(layerMatches)
+			for (auto& slider : entry.second)
 				slider->update(camera);
 		}
 
@@ -101,20 +104,32 @@ namespace bs
 		float nearestT = std::numeric_limits<float>::max();
 		HandleSlider* overSlider = nullptr;
 		
-		for (auto& slider : mSliders)
+		UINT64 cameraLayers = camera->getLayers();
+		for (auto& entry : mSlidersPerLayer)
 		{
-			if (!slider->getEnabled())
+			if ((cameraLayers & entry.first) == 0)
 				continue;
 
-			bool layerMatches = (camera->getLayers() & slider->getLayer()) != 0;
-
-			float t;
-			if (layerMatches && slider->intersects(inputPos, inputRay, t))
+			for (auto& slider : entry.second)
 			{
-				if (t < nearestT)
+				if (!slider->getEnabled())
+					continue;
+
+				Sphere bounds;
+				if (slider->getBounds(bounds))
+				{
+					if (!bounds.intersects(inputRay).first)
+						continue;
+				}
+
+				float t;
+				if (slider->intersects(inputPos, inputRay, t))
 				{
-					overSlider = slider;
-					nearestT = t;
+					if (t < nearestT)
+					{
+						overSlider = slider;
+						nearestT = t;
+					}
 				}
 			}
 		}
@@ -124,12 +139,26 @@ namespace bs
 
 	void HandleSliderManager::_registerSlider(HandleSlider* slider)
 	{
-		mSliders.insert(slider);
+		mSlidersPerLayer[slider->getLayer()].push_back(slider);
 	}
 
 	void HandleSliderManager::_unregisterSlider(HandleSlider* slider)
 	{
-		mSliders.erase(slider);
+		auto iterFind = mSlidersPerLayer.find(slider->getLayer());
+		if (iterFind != mSlidersPerLayer.end())
+		{
+			Vector<HandleSlider*>& sliders = iterFind->second;
+
+			auto iterFindSlider = std::find(sliders.begin(), sliders.end(), slider);
+			if (iterFindSlider != sliders.end())
+			{
+				std::swap(*iterFindSlider, sliders.back());
+				sliders.pop_back();
+			}
+
+			if (sliders.empty())
+				mSlidersPerLayer.erase(iterFind);
+		}
 
 		for(auto& entry : mStates)
 		{
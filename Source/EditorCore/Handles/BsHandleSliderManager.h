@@ -54,7 +54,8 @@ namespace bs
 	private:
 
 		/**
-		 * Attempts to find slider at the specified position.
+		 * Attempts to find slider at the specified position. Sliders whose bounds aren't intersected by the pointer ray
+		 * are rejected without an exact intersection test.
 		 *
 		 * @param[in]	camera		Camera through which we're interacting with sliders.
 		 * @param[in]	inputPos	Position of the pointer.
@@ -63,7 +64,7 @@ namespace bs
 		HandleSlider* findUnderCursor(const SPtr<Camera>& camera, const Vector2I& inputPos) const;
 
 		UnorderedMap<UINT64, StatePerCamera> mStates;
-		UnorderedSet<HandleSlider*> mSliders;
+		UnorderedMap<UINT64, Vector<HandleSlider*>> mSlidersPerLayer;
 	};
 
 	/** @} */
@@ -21,6 +21,9 @@ namespace bs
 		Vector3 center = (dir1 * length + dir2 * length) * 0.5f;
 		mCollider = Rect3(center, axes, extents);
 
+		// Each corner is at most one half-length away from the center along either axis
+		setLocalBounds(Sphere(center, length));
+
 		HandleSliderManager& sliderManager = HandleManager::instance().getSliderManager();
 		sliderManager._registerSlider(this);
 	}
@@ -12,6 +12,7 @@ namespace bs
 		: HandleSlider(fixedScale, layer)
 	{
 		mSphereCollider = Sphere(Vector3::ZERO, radius);
+		setLocalBounds(mSphereCollider);
 
 		HandleSliderManager& sliderManager = HandleManager::instance().getSliderManager();
 		sliderManager._registerSlider(this);
@@ -34,7 +35,7 @@ namespace bs
 
 		if (intersect.first)
 		{
-			Vector3 intrPoint = localRay.getPoint(t);
+			Vector3 intrPoint = localRay.getPoint(intersect.second);
 			intrPoint = getTransform().multiplyAffine(intrPoint);
 			t = (intrPoint - ray.getOrigin()).length(); // Get distance in world space
 
@@ -418,6 +418,9 @@ namespace bs
 	bool ProjectLibrary::reimportResourceInternal(FileEntry* fileEntry, const SPtr<ImportOptions>& importOptions,
 		bool forceReimport, bool pruneResourceMetas, bool synchronous)
 	{
+		// Don't read a file that is still being written
+		waitForQueuedSaves(fileEntry->path);
+
 		Path metaPath = fileEntry->path;
 		metaPath.setFilename(metaPath.getFilename() + ".meta");
 
@@ -813,6 +816,9 @@ namespace bs
 
 	void ProjectLibrary::_finishQueuedImports(bool wait)
 	{
+		// Finished saves queue imports of their own, so handle them first
+		_finishQueuedSaves(wait);
+
 		for(auto iter = mQueuedImports.begin(); iter != mQueuedImports.end();)
 		{
 			if(finishQueuedImport(iter->first, *iter->second, wait))
@@ -822,6 +828,39 @@ namespace bs
 		}
 	}
 
+	void ProjectLibrary::_finishQueuedSaves(bool wait)
+	{
+		for(auto iter = mQueuedSaves.begin(); iter != mQueuedSaves.end();)
+		{
+			if(!iter->saveTask->isComplete())
+			{
+				if(!wait)
+				{
+					++iter;
+					continue;
+				}
+
+				iter->saveTask->wait();
+			}
+
+			// Only the saved file needs updating, no need to check the rest of the library for modifications
+			LibraryEntry* fileEntry = findEntry(iter->filePath).get();
+			if(fileEntry && fileEntry->type == LibraryEntryType::File)
+				reimportResourceInternal(static_cast<FileEntry*>(fileEntry), nullptr, true, false, false);
+
+			iter = mQueuedSaves.erase(iter);
+		}
+	}
+
+	void ProjectLibrary::waitForQueuedSaves(const Path& path)
+	{
+		for(auto& queuedSave : mQueuedSaves)
+		{
+			if(queuedSave.filePath == path || path.includes(queuedSave.filePath))
+				queuedSave.saveTask->wait();
+		}
+	}
+
 	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
 	{
 		SPtr<QueuedImport> queuedImport;
@@ -1134,7 +1173,7 @@ namespace bs
 		addResourceInternal(entryParent, absPath, nullptr, true, true);
 	}
 
-	void ProjectLibrary::saveEntry(const HResource& resource)
+	void ProjectLibrary::saveEntry(const HResource& resource, bool synchronous)
 	{
 		if (resource == nullptr)
 			return;
@@ -1149,11 +1188,41 @@ namespace bs
 
 		filePath.makeAbsolute(getResourcesFolder());
 
-		Resources::instance().save(resource, filePath, true);
+		if(synchronous)
+		{
+			Resources::instance().save(resource, filePath, true);
+
+			LibraryEntry* fileEntry = findEntry(filePath).get();
+			if(fileEntry)
+				reimportResourceInternal(static_cast<FileEntry*>(fileEntry), nullptr, true, false, true);
 
-		LibraryEntry* fileEntry = findEntry(filePath).get();
-		if(fileEntry)
-			reimportResourceInternal(static_cast<FileEntry*>(fileEntry), nullptr, true, false, true);
+			return;
+		}
+
+		if(!resource.isLoaded(false))
+		{
+			BS_LOG(Warning, Editor, "Trying to save a resource that hasn't been loaded yet.");
+			return;
+		}
+
+		// Only allow a single write to the same file at once
+		waitForQueuedSaves(filePath);
+
+		// Written through the engine's own save path, so the file always matches what the resource loader expects.
+		// The worker encodes the resource itself, so the caller must hand over a snapshot it won't modify until the
+		// save finishes. load() waits for pending saves, so a resource re-loaded through the library is safe to modify.
+		SPtr<Resource> resourcePtr = resource.getInternalPtr();
+		const auto saveAsync = [resourcePtr, filePath]()
+		{
+			gResources()._save(resourcePtr, filePath, false);
+		};
+
+		QueuedSave queuedSave;
+		queuedSave.filePath = filePath;
+		queuedSave.saveTask = Task::create("ProjectLibrarySave", saveAsync, TaskPriority::Normal);
+
+		TaskScheduler::instance().addTask(queuedSave.saveTask);
+		mQueuedSaves.push_back(queuedSave);
 	}
 
 	void ProjectLibrary::createFolderEntry(const Path& path)
@@ -1198,6 +1267,9 @@ namespace bs
 		if (!newFullPath.isAbsolute())
 			newFullPath.makeAbsolute(mResourcesFolder);
 
+		waitForQueuedSaves(oldFullPath);
+		waitForQueuedSaves(newFullPath);
+
 		Path parentPath = newFullPath.getParent();
 		if (!FileSystem::isDirectory(parentPath))
 		{
@@ -1327,6 +1399,9 @@ namespace bs
 		if (!newFullPath.isAbsolute())
 			newFullPath.makeAbsolute(mResourcesFolder);
 
+		waitForQueuedSaves(oldFullPath);
+		waitForQueuedSaves(newFullPath);
+
 		if (!FileSystem::exists(oldFullPath))
 			return;
 
@@ -1417,6 +1492,8 @@ namespace bs
 		if (!fullPath.isAbsolute())
 			fullPath.makeAbsolute(mResourcesFolder);
 
+		waitForQueuedSaves(fullPath);
+
 		if(FileSystem::exists(fullPath))
 			FileSystem::remove(fullPath);
 
@@ -1560,6 +1637,13 @@ namespace bs
 		if (meta == nullptr)
 			return HResource();
 
+		// Loading reads the file from disk and the caller may modify the result, make sure no save is still using it
+		Path fullPath = path;
+		if (!fullPath.isAbsolute())
+			fullPath.makeAbsolute(mResourcesFolder);
+
+		waitForQueuedSaves(fullPath);
+
 		ResourceLoadFlags loadFlags = ResourceLoadFlag::Default | ResourceLoadFlag::KeepSourceData;
 
 		const UUID& resUUID = meta->getUUID();
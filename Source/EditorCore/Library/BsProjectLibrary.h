@@ -150,8 +150,17 @@ namespace bs
 		 */
 		void createFolderEntry(const Path& path);
 
-		/**	Updates a resource that is already in the library. */
-		void saveEntry(const HResource& resource);
+		/**
+		 * Updates a resource that is already in the library.
+		 *
+		 * @param[in]	resource	Resource to save.
+		 * @param[in]	synchronous	If true the resource will be written and its library entry updated on the calling
+		 *							thread. If false the resource will be encoded and written on a worker thread, and its
+		 *							library entry updated once the write finishes, through _finishQueuedSaves(). The
+		 *							resource must not be modified until then. Loading it through load() waits for the
+		 *							write to finish.
+		 */
+		void saveEntry(const HResource& resource, bool synchronous = true);
 
 		/**
 		 * Moves a library entry from one path to another.
@@ -293,6 +302,14 @@ namespace bs
 		 */
 		void _finishQueuedImports(bool wait = false);
 
+		/** 
+		 * Iterates over any queued save operations, checks if they have finished and updates the library entries of the
+		 * saved resources. Called automatically by _finishQueuedImports().
+		 *
+		 * @param[in]	wait	If true the method will block until all saves finish.
+		 */
+		void _finishQueuedSaves(bool wait = false);
+
 		/** @} */
 
 		static const Path RESOURCES_DIR;
@@ -329,6 +346,13 @@ namespace bs
 			std::time_t timestamp = 0;
 		};
 
+		/** Information about an asynchronously queued save. */
+		struct QueuedSave
+		{
+			Path filePath;
+			SPtr<Task> saveTask;
+		};
+
 		/**
 		 * Common code for adding a new resource entry to the library.
 		 *
@@ -463,6 +487,12 @@ namespace bs
 		 */
 		bool finishQueuedImport(FileEntry* fileEntry, const QueuedImport& import, bool wait);
 
+		/**
+		 * Blocks until any queued saves writing to the provided file, or to any file within the provided folder, finish.
+		 * The library entries of the saved files are not updated, that is left to _finishQueuedSaves().
+		 */
+		void waitForQueuedSaves(const Path& path);
+
 		/** 
 		 * Checks if there are any queued imports queued for the provided file entry, and if there are waits until they
 		 * finish before returning.s
@@ -480,6 +510,7 @@ namespace bs
 
 		Mutex mQueuedImportMutex;
 		UnorderedMap<FileEntry*, SPtr<QueuedImport>> mQueuedImports;
+		Vector<QueuedSave> mQueuedSaves;
 
 		UnorderedMap<Path, Vector<Path>> mDependencies;
 		UnorderedMap<UUID, Path> mUUIDToPath;
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Scene/BsGizmoManager.h"
 #include "Mesh/BsMesh.h"
+#include "Mesh/BsMeshData.h"
 #include "Math/BsAABox.h"
 #include "Math/BsSphere.h"
 #include "RenderAPI/BsVertexDataDesc.h"
@@ -18,6 +19,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Renderer/BsRendererManager.h"
 #include "Utility/BsDrawHelper.h"
+#include "Math/BsConvexVolume.h"
 
 using namespace std::placeholders;
 
@@ -27,6 +29,58 @@ namespace bs
 	const UINT32 GizmoManager::WIRE_SPHERE_QUALITY = 10;
 	const UINT32 GizmoManager::OPTIMAL_ICON_SIZE = 64;
 	const float GizmoManager::ICON_TEXEL_WORLD_SIZE = 0.015f;
+	const UINT32 GizmoManager::ICON_MESH_MIN_CAPACITY = 64;
+
+	/** Accumulates a 64-bit FNV-1a hash of the data recorded for gizmos. */
+	struct GizmoDrawHasher
+	{
+		/** Adds the bytes of a POD value to the hash. */
+		template<class T>
+		void add(const T& value)
+		{
+			addBytes(&value, sizeof(value));
+		}
+
+		/** Adds a sequence of raw bytes to the hash. */
+		void addBytes(const void* data, size_t size)
+		{
+			const UINT8* bytes = (const UINT8*)data;
+			for (size_t i = 0; i < size; i++)
+			{
+				hash ^= bytes[i];
+				hash *= 1099511628211ULL;
+			}
+		}
+
+		UINT64 hash = 14695981039346656037ULL;
+	};
+
+	/** Returns the bounds of a box with the provided center and half-size. */
+	static AABox getBoxBounds(const Vector3& center, const Vector3& extents)
+	{
+		return AABox(center - extents, center + extents);
+	}
+
+	/** Returns the bounds of a sphere. Also used for shapes contained in a sphere, like discs and arcs. */
+	static AABox getSphereBounds(const Vector3& center, float radius)
+	{
+		Vector3 extents(radius, radius, radius);
+		return AABox(center - extents, center + extents);
+	}
+
+	/** Returns the bounds enclosing all of the provided points. At least one point must be provided. */
+	static AABox getPointBounds(const Vector3* points, UINT32 numPoints)
+	{
+		Vector3 min = points[0];
+		Vector3 max = points[0];
+		for (UINT32 i = 1; i < numPoints; i++)
+		{
+			min = Vector3(std::min(min.x, points[i].x), std::min(min.y, points[i].y), std::min(min.z, points[i].z));
+			max = Vector3(std::max(max.x, points[i].x), std::max(max.y, points[i].y), std::max(max.z, points[i].z));
+		}
+
+		return AABox(min, max);
+	}
 
 	GizmoManager::GizmoManager()
 	{
@@ -76,7 +130,6 @@ namespace bs
 		if(mTransformDirty)
 		{
 			mTransform = Matrix4::IDENTITY;
-			mDrawHelper->setTransform(Matrix4::IDENTITY);
 			mTransformDirty = false;
 		}
 
@@ -94,7 +147,6 @@ namespace bs
 
 	void GizmoManager::setColor(const Color& color)
 	{
-		mDrawHelper->setColor(color);
 		mColor = color;
 
 		mColorDirty = true;
@@ -102,7 +154,6 @@ namespace bs
 
 	void GizmoManager::setTransform(const Matrix4& transform)
 	{
-		mDrawHelper->setTransform(transform);
 		mTransform = transform;
 
 		mTransformDirty = true;
@@ -121,7 +172,6 @@ namespace bs
 		cubeData.sceneObject = mActiveSO;
 		cubeData.pickable = mPickable;
 
-		mDrawHelper->cube(position, extents);
 		mIdxToSceneObjectMap[cubeData.idx] = mActiveSO;
 	}
 
@@ -138,7 +188,6 @@ namespace bs
 		sphereData.sceneObject = mActiveSO;
 		sphereData.pickable = mPickable;
 
-		mDrawHelper->sphere(position, radius);
 		mIdxToSceneObjectMap[sphereData.idx] = mActiveSO;
 	}
 
@@ -149,6 +198,8 @@ namespace bs
 
 		coneData.idx = mCurrentIdx++;
 		coneData.base = base;
+		coneData.normal = normal;
+		coneData.height = height;
 		coneData.radius = radius;
 		coneData.color = mColor;
 		coneData.transform = mTransform;
@@ -156,7 +207,6 @@ namespace bs
 		coneData.pickable = mPickable;
 		coneData.scale = scale;
 
-		mDrawHelper->cone(base, normal, height, radius, scale);
 		mIdxToSceneObjectMap[coneData.idx] = mActiveSO;
 	}
 
@@ -174,7 +224,6 @@ namespace bs
 		discData.sceneObject = mActiveSO;
 		discData.pickable = mPickable;
 
-		mDrawHelper->disc(position, normal, radius);
 		mIdxToSceneObjectMap[discData.idx] = mActiveSO;
 	}
 
@@ -191,7 +240,6 @@ namespace bs
 		cubeData.sceneObject = mActiveSO;
 		cubeData.pickable = mPickable;
 
-		mDrawHelper->wireCube(position, extents);
 		mIdxToSceneObjectMap[cubeData.idx] = mActiveSO;
 	}
 
@@ -208,7 +256,6 @@ namespace bs
 		sphereData.sceneObject = mActiveSO;
 		sphereData.pickable = mPickable;
 
-		mDrawHelper->wireSphere(position, radius);
 		mIdxToSceneObjectMap[sphereData.idx] = mActiveSO;
 	}
 
@@ -225,7 +272,6 @@ namespace bs
 		sphereData.sceneObject = mActiveSO;
 		sphereData.pickable = mPickable;
 
-		mDrawHelper->wireHemisphere(position, radius);
 		mIdxToSceneObjectMap[sphereData.idx] = mActiveSO;
 	}
 
@@ -272,6 +318,8 @@ namespace bs
 
 		coneData.idx = mCurrentIdx++;
 		coneData.base = base;
+		coneData.normal = normal;
+		coneData.height = height;
 		coneData.radius = radius;
 		coneData.color = mColor;
 		coneData.transform = mTransform;
@@ -279,7 +327,6 @@ namespace bs
 		coneData.pickable = mPickable;
 		coneData.scale = scale;
 
-		mDrawHelper->wireCone(base, normal, height, radius, scale);
 		mIdxToSceneObjectMap[coneData.idx] = mActiveSO;
 	}
 
@@ -296,7 +343,6 @@ namespace bs
 		lineData.sceneObject = mActiveSO;
 		lineData.pickable = mPickable;
 
-		mDrawHelper->line(start, end);
 		mIdxToSceneObjectMap[lineData.idx] = mActiveSO;
 	}
 
@@ -312,7 +358,6 @@ namespace bs
 		lineListData.sceneObject = mActiveSO;
 		lineListData.pickable = mPickable;
 
-		mDrawHelper->lineList(linePoints);
 		mIdxToSceneObjectMap[lineListData.idx] = mActiveSO;
 	}
 
@@ -330,7 +375,6 @@ namespace bs
 		wireDiscData.sceneObject = mActiveSO;
 		wireDiscData.pickable = mPickable;
 
-		mDrawHelper->wireDisc(position, normal, radius);
 		mIdxToSceneObjectMap[wireDiscData.idx] = mActiveSO;
 	}
 
@@ -351,7 +395,6 @@ namespace bs
 		wireArcData.sceneObject = mActiveSO;
 		wireArcData.pickable = mPickable;
 
-		mDrawHelper->wireArc(position, normal, radius, startAngle, amountAngle);
 		mIdxToSceneObjectMap[wireArcData.idx] = mActiveSO;
 	}
 
@@ -367,7 +410,6 @@ namespace bs
 		wireMeshData.sceneObject = mActiveSO;
 		wireMeshData.pickable = mPickable;
 
-		mDrawHelper->wireMesh(meshData);
 		mIdxToSceneObjectMap[wireMeshData.idx] = mActiveSO;
 	}
 
@@ -387,7 +429,6 @@ namespace bs
 		frustumData.sceneObject = mActiveSO;
 		frustumData.pickable = mPickable;
 
-		mDrawHelper->frustum(position, aspect, FOV, near, far);
 		mIdxToSceneObjectMap[frustumData.idx] = mActiveSO;
 	}
 
@@ -427,7 +468,6 @@ namespace bs
 		textData.sceneObject = mActiveSO;
 		textData.pickable = mPickable;
 
-		mDrawHelper->text(position, text, myFont, fontSize);
 		mIdxToSceneObjectMap[textData.idx] = mActiveSO;
 	}
 
@@ -453,15 +493,187 @@ namespace bs
 		return proxyData;
 	}
 
+	UINT64 GizmoManager::calculateDrawHash(const GizmoDrawSettings& drawSettings) const
+	{
+		GizmoDrawHasher hasher;
+		hasher.add(drawSettings.shapeRange);
+
+		auto hashCommon = [&hasher](const CommonData& data)
+		{
+			hasher.add(data.color);
+			hasher.add(data.transform);
+		};
+
+		hasher.add((UINT32)mSolidCubeData.size());
+		for (auto& entry : mSolidCubeData) { hashCommon(entry); hasher.add(entry.position); hasher.add(entry.extents); }
+		hasher.add((UINT32)mWireCubeData.size());
+		for (auto& entry : mWireCubeData) { hashCommon(entry); hasher.add(entry.position); hasher.add(entry.extents); }
+		hasher.add((UINT32)mSolidSphereData.size());
+		for (auto& entry : mSolidSphereData) { hashCommon(entry); hasher.add(entry.position); hasher.add(entry.radius); }
+		hasher.add((UINT32)mWireSphereData.size());
+		for (auto& entry : mWireSphereData) { hashCommon(entry); hasher.add(entry.position); hasher.add(entry.radius); }
+		hasher.add((UINT32)mWireHemisphereData.size());
+		for (auto& entry : mWireHemisphereData) { hashCommon(entry); hasher.add(entry.position); hasher.add(entry.radius); }
+
+		auto hashCone = [&](const ConeData& data)
+		{
+			hashCommon(data);
+			hasher.add(data.base);
+			hasher.add(data.normal);
+			hasher.add(data.radius);
+			hasher.add(data.height);
+			hasher.add(data.scale);
+		};
+
+		hasher.add((UINT32)mSolidConeData.size());
+		for (auto& entry : mSolidConeData) hashCone(entry);
+		hasher.add((UINT32)mWireConeData.size());
+		for (auto& entry : mWireConeData) hashCone(entry);
+
+		hasher.add((UINT32)mLineData.size());
+		for (auto& entry : mLineData) { hashCommon(entry); hasher.add(entry.start); hasher.add(entry.end); }
+
+		hasher.add((UINT32)mLineListData.size());
+		for (auto& entry : mLineListData)
+		{
+			hashCommon(entry);
+			hasher.add((UINT32)entry.linePoints.size());
+
+			for (auto& point : entry.linePoints)
+				hasher.add(point);
+		}
+
+		auto hashDisc = [&](const DiscData& data)
+		{
+			hashCommon(data);
+			hasher.add(data.position);
+			hasher.add(data.normal);
+			hasher.add(data.radius);
+		};
+
+		hasher.add((UINT32)mSolidDiscData.size());
+		for (auto& entry : mSolidDiscData) hashDisc(entry);
+		hasher.add((UINT32)mWireDiscData.size());
+		for (auto& entry : mWireDiscData) hashDisc(entry);
+
+		hasher.add((UINT32)mWireArcData.size());
+		for (auto& entry : mWireArcData)
+		{
+			hashCommon(entry);
+			hasher.add(entry.position);
+			hasher.add(entry.normal);
+			hasher.add(entry.radius);
+			hasher.add(entry.startAngle.valueDegrees());
+			hasher.add(entry.amountAngle.valueDegrees());
+		}
+
+		hasher.add((UINT32)mWireMeshData.size());
+		for (auto& entry : mWireMeshData)
+		{
+			hashCommon(entry);
+
+			// Mesh data can be modified in place, or a new one can be allocated at the same address, so hash
+			// the contents instead of the pointer
+			const SPtr<MeshData>& meshData = entry.meshData;
+			if (meshData == nullptr)
+				continue;
+
+			UINT32 numVertices = meshData->getNumVertices();
+			UINT32 numIndices = meshData->getNumIndices();
+			hasher.add(numVertices);
+			hasher.add(numIndices);
+
+			const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+			const VertexElement* positionElement = nullptr;
+			for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			{
+				const VertexElement& element = vertexDesc->getElement(i);
+				if (element.getSemantic() == VES_POSITION && element.getSemanticIdx() == 0)
+				{
+					positionElement = &element;
+					break;
+				}
+			}
+
+			if (positionElement != nullptr)
+			{
+				UINT32 streamIdx = positionElement->getStreamIdx();
+				UINT8* positions = meshData->getElementData(VES_POSITION, 0, streamIdx);
+				UINT32 stride = vertexDesc->getVertexStride(streamIdx);
+				UINT32 positionSize = positionElement->getSize();
+
+				for (UINT32 i = 0; i < numVertices; i++)
+					hasher.addBytes(positions + i * stride, positionSize);
+			}
+
+			if (meshData->getIndexType() == IT_32BIT)
+				hasher.addBytes(meshData->getIndices32(), numIndices * sizeof(UINT32));
+			else
+				hasher.addBytes(meshData->getIndices16(), numIndices * sizeof(UINT16));
+		}
+
+		hasher.add((UINT32)mFrustumData.size());
+		for (auto& entry : mFrustumData)
+		{
+			hashCommon(entry);
+			hasher.add(entry.position);
+			hasher.add(entry.aspect);
+			hasher.add(entry.FOV.valueDegrees());
+			hasher.add(entry.near);
+			hasher.add(entry.far);
+		}
+
+		hasher.add((UINT32)mTextData.size());
+		for (auto& entry : mTextData)
+		{
+			hashCommon(entry);
+			hasher.add(entry.position);
+			hasher.add(entry.fontSize);
+			hasher.add(entry.font.getUUID());
+			hasher.addBytes(entry.text.data(), entry.text.size());
+		}
+
+		return hasher.hash;
+	}
+
 	void GizmoManager::update(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings)
 	{
-		mActiveMeshes.clear();
-		mActiveMeshes = mDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, camera.get());
+		// Most gizmos stay the same between frames, in which case there is no need to re-tessellate them. Meshes are
+		// sorted back to front and culled against the camera frustum, so they also need to be rebuilt whenever the camera
+		// moves or its projection changes.
+		UINT64 drawHash = calculateDrawHash(drawSettings);
+		Matrix4 viewProjMatrix = camera->getProjectionMatrixRS() * camera->getViewMatrix();
+
+		bool rebuildMeshes = mActiveMeshesDirty || drawHash != mActiveMeshesHash || 
+			camera.get() != mActiveMeshesCamera || viewProjMatrix != mActiveMeshesViewProj;
+
+		Vector<MeshRenderData> proxyData;
+		if(rebuildMeshes)
+		{
+			mCullStats.numShapesDrawn = 0;
+			mCullStats.numShapesCulled = 0;
+			recordShapes(*mDrawHelper, camera, drawSettings, nullptr, mCullStats);
+
+			mActiveMeshes.clear();
+			mActiveMeshes = mDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, camera.get());
+
+			proxyData = createMeshProxyData(mActiveMeshes);
+
+			mActiveMeshesHash = drawHash;
+			mActiveMeshesCamera = camera.get();
+			mActiveMeshesViewProj = viewProjMatrix;
+			mActiveMeshesDirty = false;
+		}
 
-		Vector<MeshRenderData> proxyData = createMeshProxyData(mActiveMeshes);
 		IconRenderDataVecPtr iconRenderData;
 		mIconMesh = buildIconMesh(camera, drawSettings, mIconData, false, iconRenderData);
 
+		mCullStats.numIconsDrawn = 0;
+		for (auto& entry : *iconRenderData)
+			mCullStats.numIconsDrawn += entry.count;
+
+		mCullStats.numIconsCulled = (UINT32)mIconData.size() - mCullStats.numIconsDrawn;
+
 		SPtr<ct::MeshBase> iconMesh;
 		if(mIconMesh != nullptr)
 			iconMesh = mIconMesh->getCore();
@@ -469,186 +681,165 @@ namespace bs
 		ct::GizmoRenderer* renderer = mGizmoRenderer.get();
 
 		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::updateData, renderer, camera->getCore(),
-			proxyData, iconMesh, iconRenderData));
+			proxyData, iconMesh, iconRenderData, rebuildMeshes));
 	}
 
-	void GizmoManager::renderForPicking(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
-		std::function<Color(UINT32)> idxToColorCallback)
+	void GizmoManager::recordShapes(DrawHelper& drawHelper, const SPtr<Camera>& camera, 
+		const GizmoDrawSettings& drawSettings, const std::function<Color(UINT32)>& idxToColorCallback, 
+		GizmoCullStats& stats)
 	{
-		Vector<IconData> iconData;
-		IconRenderDataVecPtr iconRenderData;
+		drawHelper.clear();
 
-		mPickingDrawHelper->clear();
+		const ConvexVolume& frustum = camera->getWorldFrustum();
+		Vector3 cameraPosition = camera->getTransform().getPosition();
+		float maxDistanceSqrd = drawSettings.shapeRange * drawSettings.shapeRange;
+		bool forPicking = idxToColorCallback != nullptr;
 
-		for (auto& cubeDataEntry : mSolidCubeData)
+		// Culls the shape and sets up the draw helper for recording it. Returns false if the shape shouldn't be recorded.
+		auto prepare = [&](const CommonData& data, const AABox& localBounds)
 		{
-			if (!cubeDataEntry.pickable)
-				continue;
+			if (forPicking && !data.pickable)
+				return false;
 
-			mPickingDrawHelper->setColor(idxToColorCallback(cubeDataEntry.idx));
-			mPickingDrawHelper->setTransform(cubeDataEntry.transform);
+			AABox bounds = localBounds;
+			bounds.transformAffine(data.transform);
 
-			mPickingDrawHelper->cube(cubeDataEntry.position, cubeDataEntry.extents);
-		}
+			bool culled = false;
+			if (drawSettings.shapeRange > 0.0f)
+			{
+				const Vector3& min = bounds.getMin();
+				const Vector3& max = bounds.getMax();
 
-		for (auto& cubeDataEntry : mWireCubeData)
-		{
-			if (!cubeDataEntry.pickable)
-				continue;
+				Vector3 closestPoint(
+					std::min(std::max(cameraPosition.x, min.x), max.x),
+					std::min(std::max(cameraPosition.y, min.y), max.y),
+					std::min(std::max(cameraPosition.z, min.z), max.z));
 
-			mPickingDrawHelper->setColor(idxToColorCallback(cubeDataEntry.idx));
-			mPickingDrawHelper->setTransform(cubeDataEntry.transform);
+				culled = cameraPosition.squaredDistance(closestPoint) > maxDistanceSqrd;
+			}
 
-			mPickingDrawHelper->wireCube(cubeDataEntry.position, cubeDataEntry.extents);
-		}
+			if (!culled)
+				culled = !frustum.intersects(bounds);
 
-		for (auto& sphereDataEntry : mSolidSphereData)
-		{
-			if (!sphereDataEntry.pickable)
-				continue;
+			if (culled)
+			{
+				stats.numShapesCulled++;
+				return false;
+			}
 
-			mPickingDrawHelper->setColor(idxToColorCallback(sphereDataEntry.idx));
-			mPickingDrawHelper->setTransform(sphereDataEntry.transform);
+			stats.numShapesDrawn++;
 
-			mPickingDrawHelper->sphere(sphereDataEntry.position, sphereDataEntry.radius);
-		}
+			drawHelper.setColor(forPicking ? idxToColorCallback(data.idx) : data.color);
+			drawHelper.setTransform(data.transform);
+			return true;
+		};
 
-		for (auto& sphereDataEntry : mWireSphereData)
+		for (auto& entry : mSolidCubeData)
 		{
-			if (!sphereDataEntry.pickable)
-				continue;
-
-			mPickingDrawHelper->setColor(idxToColorCallback(sphereDataEntry.idx));
-			mPickingDrawHelper->setTransform(sphereDataEntry.transform);
-
-			mPickingDrawHelper->wireSphere(sphereDataEntry.position, sphereDataEntry.radius);
+			if (prepare(entry, getBoxBounds(entry.position, entry.extents)))
+				drawHelper.cube(entry.position, entry.extents);
 		}
 
-		for (auto& sphereDataEntry : mWireSphereData)
+		for (auto& entry : mWireCubeData)
 		{
-			if (!sphereDataEntry.pickable)
-				continue;
-
-			mPickingDrawHelper->setColor(idxToColorCallback(sphereDataEntry.idx));
-			mPickingDrawHelper->setTransform(sphereDataEntry.transform);
-
-			mPickingDrawHelper->wireHemisphere(sphereDataEntry.position, sphereDataEntry.radius);
+			if (prepare(entry, getBoxBounds(entry.position, entry.extents)))
+				drawHelper.wireCube(entry.position, entry.extents);
 		}
 
-		for (auto& coneDataEntry : mSolidConeData)
+		for (auto& entry : mSolidSphereData)
 		{
-			if (!coneDataEntry.pickable)
-				continue;
-
-			mPickingDrawHelper->setColor(idxToColorCallback(coneDataEntry.idx));
-			mPickingDrawHelper->setTransform(coneDataEntry.transform);
-
-			mPickingDrawHelper->cone(coneDataEntry.base, coneDataEntry.normal, coneDataEntry.radius, coneDataEntry.radius, 
-				coneDataEntry.scale);
+			if (prepare(entry, getSphereBounds(entry.position, entry.radius)))
+				drawHelper.sphere(entry.position, entry.radius);
 		}
 
-		for (auto& coneDataEntry : mWireConeData)
+		for (auto& entry : mWireSphereData)
 		{
-			if (!coneDataEntry.pickable)
-				continue;
-
-			mPickingDrawHelper->setColor(idxToColorCallback(coneDataEntry.idx));
-			mPickingDrawHelper->setTransform(coneDataEntry.transform);
-
-			mPickingDrawHelper->wireCone(coneDataEntry.base, coneDataEntry.normal, coneDataEntry.radius, coneDataEntry.radius,
-				coneDataEntry.scale);
+			if (prepare(entry, getSphereBounds(entry.position, entry.radius)))
+				drawHelper.wireSphere(entry.position, entry.radius);
 		}
 
-		for (auto& lineDataEntry : mLineData)
+		for (auto& entry : mWireHemisphereData)
 		{
-			if (!lineDataEntry.pickable)
-				continue;
-
-			mPickingDrawHelper->setColor(idxToColorCallback(lineDataEntry.idx));
-			mPickingDrawHelper->setTransform(lineDataEntry.transform);
-
-			mPickingDrawHelper->line(lineDataEntry.start, lineDataEntry.end);
+			if (prepare(entry, getSphereBounds(entry.position, entry.radius)))
+				drawHelper.wireHemisphere(entry.position, entry.radius);
 		}
 
-		for (auto& lineListDataEntry : mLineListData)
+		for (auto& entry : mSolidConeData)
 		{
-			if (!lineListDataEntry.pickable)
-				continue;
-
-			mPickingDrawHelper->setColor(idxToColorCallback(lineListDataEntry.idx));
-			mPickingDrawHelper->setTransform(lineListDataEntry.transform);
-
-			mPickingDrawHelper->lineList(lineListDataEntry.linePoints);
+			if (prepare(entry, getConeBounds(entry)))
+				drawHelper.cone(entry.base, entry.normal, entry.height, entry.radius, entry.scale);
 		}
 
-		for (auto& discDataEntry : mSolidDiscData)
+		for (auto& entry : mWireConeData)
 		{
-			if (!discDataEntry.pickable)
-				continue;
-
-			mPickingDrawHelper->setColor(idxToColorCallback(discDataEntry.idx));
-			mPickingDrawHelper->setTransform(discDataEntry.transform);
-
-			mPickingDrawHelper->disc(discDataEntry.position, discDataEntry.normal, discDataEntry.radius);
+			if (prepare(entry, getConeBounds(entry)))
+				drawHelper.wireCone(entry.base, entry.normal, entry.height, entry.radius, entry.scale);
 		}
 
-		for (auto& discDataEntry : mWireDiscData)
+		for (auto& entry : mLineData)
 		{
-			if (!discDataEntry.pickable)
-				continue;
-
-			mPickingDrawHelper->setColor(idxToColorCallback(discDataEntry.idx));
-			mPickingDrawHelper->setTransform(discDataEntry.transform);
-
-			mPickingDrawHelper->wireDisc(discDataEntry.position, discDataEntry.normal, discDataEntry.radius);
+			Vector3 points[] = { entry.start, entry.end };
+			if (prepare(entry, getPointBounds(points, 2)))
+				drawHelper.line(entry.start, entry.end);
 		}
 
-		for (auto& wireArcDataEntry : mWireArcData)
+		for (auto& entry : mLineListData)
 		{
-			if (!wireArcDataEntry.pickable)
+			if (entry.linePoints.empty())
 				continue;
 
-			mPickingDrawHelper->setColor(idxToColorCallback(wireArcDataEntry.idx));
-			mPickingDrawHelper->setTransform(wireArcDataEntry.transform);
-
-			mPickingDrawHelper->wireArc(wireArcDataEntry.position, wireArcDataEntry.normal, wireArcDataEntry.radius, 
-				wireArcDataEntry.startAngle, wireArcDataEntry.amountAngle);
+			if (prepare(entry, getPointBounds(entry.linePoints.data(), (UINT32)entry.linePoints.size())))
+				drawHelper.lineList(entry.linePoints);
 		}
 
-		for (auto& wireMeshData : mWireMeshData)
+		for (auto& entry : mSolidDiscData)
 		{
-			if (!wireMeshData.pickable)
-				continue;
+			if (prepare(entry, getSphereBounds(entry.position, entry.radius)))
+				drawHelper.disc(entry.position, entry.normal, entry.radius);
+		}
 
-			mPickingDrawHelper->setColor(idxToColorCallback(wireMeshData.idx));
-			mPickingDrawHelper->setTransform(wireMeshData.transform);
+		for (auto& entry : mWireDiscData)
+		{
+			if (prepare(entry, getSphereBounds(entry.position, entry.radius)))
+				drawHelper.wireDisc(entry.position, entry.normal, entry.radius);
+		}
 
-			mPickingDrawHelper->wireMesh(wireMeshData.meshData);
+		for (auto& entry : mWireArcData)
+		{
+			if (prepare(entry, getSphereBounds(entry.position, entry.radius)))
+				drawHelper.wireArc(entry.position, entry.normal, entry.radius, entry.startAngle, entry.amountAngle);
 		}
 
-		for (auto& frustumDataEntry : mFrustumData)
+		for (auto& entry : mWireMeshData)
 		{
-			if (!frustumDataEntry.pickable)
+			if (entry.meshData == nullptr)
 				continue;
 
-			mPickingDrawHelper->setColor(idxToColorCallback(frustumDataEntry.idx));
-			mPickingDrawHelper->setTransform(frustumDataEntry.transform);
+			if (prepare(entry, entry.meshData->calculateBounds().getBox()))
+				drawHelper.wireMesh(entry.meshData);
+		}
 
-			mPickingDrawHelper->frustum(frustumDataEntry.position, frustumDataEntry.aspect, frustumDataEntry.FOV, 
-				frustumDataEntry.near, frustumDataEntry.far);
+		for (auto& entry : mFrustumData)
+		{
+			if (prepare(entry, getFrustumBounds(entry)))
+				drawHelper.frustum(entry.position, entry.aspect, entry.FOV, entry.near, entry.far);
 		}
 
-		for (auto& textDataEntry : mTextData)
+		for (auto& entry : mTextData)
 		{
-			if (!textDataEntry.pickable)
-				continue;
+			if (prepare(entry, AABox(entry.position, entry.position)))
+				drawHelper.text(entry.position, entry.text, entry.font, entry.fontSize);
+		}
+	}
 
-			mPickingDrawHelper->setColor(idxToColorCallback(textDataEntry.idx));
-			mPickingDrawHelper->setTransform(textDataEntry.transform);
+	void GizmoManager::renderForPicking(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
+		std::function<Color(UINT32)> idxToColorCallback)
+	{
+		Vector<IconData> iconData;
+		IconRenderDataVecPtr iconRenderData;
 
-			mPickingDrawHelper->text(textDataEntry.position, textDataEntry.text, textDataEntry.font,
-				textDataEntry.fontSize);
-		}
+		GizmoCullStats cullStats;
+		recordShapes(*mPickingDrawHelper, camera, drawSettings, idxToColorCallback, cullStats);
 
 		for (auto& iconDataEntry : mIconData)
 		{
@@ -676,6 +867,107 @@ namespace bs
 											 proxyData, iconMeshCore, iconRenderData, true));
 	}
 
+	AABox GizmoManager::getConeBounds(const ConeData& data)
+	{
+		float radius = data.radius * std::max(data.scale.x, data.scale.y);
+
+		AABox bounds = getSphereBounds(data.base, radius);
+		bounds.merge(data.base + data.normal * data.height);
+
+		return bounds;
+	}
+
+	AABox GizmoManager::getFrustumBounds(const FrustumData& data)
+	{
+		// Sphere enclosing the far plane, centered at the frustum origin
+		float aspect = std::max(data.aspect, 0.0001f);
+		float halfSize = data.far * Math::tan(Radian(data.FOV * 0.5f)) * std::max(aspect, 1.0f / aspect);
+
+		return getSphereBounds(data.position, Math::sqrt(data.far * data.far + 2.0f * halfSize * halfSize));
+	}
+
+	void GizmoManager::getPickableBounds(Vector<PickableBounds>& output) const
+	{
+		output.clear();
+
+		auto addBounds = [&](const CommonData& data, const Vector3& min, const Vector3& max)
+		{
+			if (!data.pickable || !data.sceneObject)
+				return;
+
+			AABox bounds(min, max);
+			bounds.transformAffine(data.transform);
+
+			output.push_back({ bounds, data.sceneObject });
+		};
+
+		auto addSphere = [&](const CommonData& data, const Vector3& position, float radius)
+		{
+			AABox bounds = getSphereBounds(position, radius);
+			addBounds(data, bounds.getMin(), bounds.getMax());
+		};
+
+		auto addPoints = [&](const CommonData& data, const Vector3* points, UINT32 numPoints)
+		{
+			if (numPoints == 0)
+				return;
+
+			AABox bounds = getPointBounds(points, numPoints);
+			addBounds(data, bounds.getMin(), bounds.getMax());
+		};
+
+		for (auto& entry : mSolidCubeData)
+			addBounds(entry, entry.position - entry.extents, entry.position + entry.extents);
+
+		for (auto& entry : mWireCubeData)
+			addBounds(entry, entry.position - entry.extents, entry.position + entry.extents);
+
+		for (auto& entry : mSolidSphereData)
+			addSphere(entry, entry.position, entry.radius);
+
+		for (auto& entry : mWireSphereData)
+			addSphere(entry, entry.position, entry.radius);
+
+		for (auto& entry : mWireHemisphereData)
+			addSphere(entry, entry.position, entry.radius);
+
+		for (auto& entry : mSolidConeData)
+		{
+			AABox bounds = getConeBounds(entry);
+			addBounds(entry, bounds.getMin(), bounds.getMax());
+		}
+
+		for (auto& entry : mWireConeData)
+		{
+			AABox bounds = getConeBounds(entry);
+			addBounds(entry, bounds.getMin(), bounds.getMax());
+		}
+
+		for (auto& entry : mLineData)
+		{
+			Vector3 points[] = { entry.start, entry.end };
+			addPoints(entry, points, 2);
+		}
+
+		for (auto& entry : mLineListData)
+			addPoints(entry, entry.linePoints.data(), (UINT32)entry.linePoints.size());
+
+		for (auto& entry : mSolidDiscData)
+			addSphere(entry, entry.position, entry.radius);
+
+		for (auto& entry : mWireDiscData)
+			addSphere(entry, entry.position, entry.radius);
+
+		for (auto& entry : mWireArcData)
+			addSphere(entry, entry.position, entry.radius);
+
+		for (auto& entry : mFrustumData)
+			addBounds(entry, entry.position, entry.position);
+
+		for (auto& entry : mIconData)
+			addBounds(entry, entry.position, entry.position);
+	}
+
 	void GizmoManager::clearGizmos()
 	{
 		mSolidCubeData.clear();
@@ -704,26 +996,38 @@ namespace bs
 	void GizmoManager::clearRenderData()
 	{
 		mActiveMeshes.clear();
+		mActiveMeshesCamera = nullptr;
+		mActiveMeshesDirty = true;
 		mIconMesh = nullptr;
 
 		ct::GizmoRenderer* renderer = mGizmoRenderer.get();
 		IconRenderDataVecPtr iconRenderData = bs_shared_ptr_new<IconRenderDataVec>();
 		
 		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::updateData, renderer,
-			nullptr, Vector<MeshRenderData>(), nullptr, iconRenderData));
+			nullptr, Vector<MeshRenderData>(), nullptr, iconRenderData, true));
 	}
 
 	SPtr<Mesh> GizmoManager::buildIconMesh(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
 		const Vector<IconData>& iconData, bool forPicking, IconRenderDataVecPtr& iconRenderData)
 	{
-		mSortedIconData.clear();
-		
-		if (iconData.size() > mSortedIconData.size())
-			mSortedIconData.resize(iconData.size());
+		UINT32 numIcons = (UINT32)iconData.size();
+		if (numIcons > mSortedIconData.size())
+			mSortedIconData.resize(numIcons);
+
+		// Visit the icons in the order they were sorted in last frame, so the sort below has little work to do. The
+		// order is only reused if the icon list looks the same, otherwise start from scratch.
+		Vector<UINT32>& iconOrder = mIconOrder[forPicking ? 1 : 0];
+		if (iconOrder.size() != numIcons)
+		{
+			iconOrder.resize(numIcons);
+			for (UINT32 i = 0; i < numIcons; i++)
+				iconOrder[i] = i;
+		}
 
 		UINT32 dstIdx = 0;
-		for(UINT32 i = 0; i < (UINT32)iconData.size(); i++)
+		for(UINT32 orderIdx = 0; orderIdx < numIcons; orderIdx++)
 		{
+			UINT32 i = iconOrder[orderIdx];
 			const IconData& iconEntry = iconData[i];
 			Vector3 viewPoint = camera->worldToViewPoint(iconEntry.position);
 
@@ -744,29 +1048,37 @@ namespace bs
 			sortedIconData.iconIdx = i;
 			sortedIconData.distance = distance;
 			sortedIconData.screenPosition = camera->viewToScreenPoint(viewPoint);
+			sortedIconData.textureId = iconEntry.texture->getTexture()->getInternalID();
 
 			dstIdx++;
 		}
 
 		UINT32 actualNumIcons = dstIdx;
+		sortIcons(actualNumIcons);
 
-		// Sort back to front first, then by texture
-		std::sort(mSortedIconData.begin(), mSortedIconData.begin() + actualNumIcons, 
-			[&](const SortedIconData& a, const SortedIconData& b)
+		// Remember the new order for the next frame. Icons that weren't visible keep their relative order at the end.
 		{
-			if (a.distance == b.distance)
+			Vector<UINT32> hiddenIcons;
+			Vector<bool> isVisible(numIcons, false);
+			for (UINT32 i = 0; i < actualNumIcons; i++)
+				isVisible[mSortedIconData[i].iconIdx] = true;
+
+			for (auto& entry : iconOrder)
 			{
-				HTexture texA = iconData[a.iconIdx].texture->getTexture();
-				HTexture texB = iconData[b.iconIdx].texture->getTexture();
+				if (!isVisible[entry])
+					hiddenIcons.push_back(entry);
+			}
 
-				if (texA == texB)
-					return a.iconIdx < b.iconIdx;
+			for (UINT32 i = 0; i < actualNumIcons; i++)
+				iconOrder[i] = mSortedIconData[i].iconIdx;
 
-				return texA->getInternalID() < texB->getInternalID();
-			}
-			else
-				return a.distance > b.distance;
-		});
+			for (UINT32 i = 0; i < (UINT32)hiddenIcons.size(); i++)
+				iconOrder[actualNumIcons + i] = hiddenIcons[i];
+		}
+
+		iconRenderData = bs_shared_ptr_new<IconRenderDataVec>();
+		if (actualNumIcons == 0)
+			return nullptr;
 
 		SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(actualNumIcons * 4, actualNumIcons * 6, mIconVertexDesc);
 
@@ -786,7 +1098,6 @@ namespace bs
 			cameraScale = (camera->getViewport()->getPixelArea().height * 0.5f) / vertFOV.valueRadians();
 		}
 
-		iconRenderData = bs_shared_ptr_new<IconRenderDataVec>();
 		HTexture curTexture;
 
 		// Note: This assumes the meshes will be rendered using the same camera
@@ -877,10 +1188,74 @@ namespace bs
 			indices += 6;
 		}
 
-		if(actualNumIcons > 0)
-			return Mesh::_createPtr(meshData);
+		// Write into the next mesh in the ring, growing it if it's too small to hold all the icons
+		IconMeshRing& ring = mIconMeshRings[forPicking ? 1 : 0];
+		UINT32 ringIdx = ring.next;
+		ring.next = (ring.next + 1) % ICON_MESH_RING_SIZE;
+
+		if (ring.meshes[ringIdx] == nullptr || ring.capacities[ringIdx] < actualNumIcons)
+		{
+			UINT32 capacity = std::max(ICON_MESH_MIN_CAPACITY, ring.capacities[ringIdx]);
+			while (capacity < actualNumIcons)
+				capacity *= 2;
+
+			MESH_DESC meshDesc;
+			meshDesc.numVertices = capacity * 4;
+			meshDesc.numIndices = capacity * 6;
+			meshDesc.vertexDesc = mIconVertexDesc;
+			meshDesc.usage = MU_DYNAMIC;
+
+			ring.meshes[ringIdx] = Mesh::_createPtr(meshDesc);
+			ring.capacities[ringIdx] = capacity;
+		}
+
+		SPtr<Mesh> mesh = ring.meshes[ringIdx];
+		mesh->writeData(meshData, true);
+
+		return mesh;
+	}
+
+	void GizmoManager::sortIcons(UINT32 count)
+	{
+		// Sort back to front first, then by texture
+		auto compare = [](const SortedIconData& a, const SortedIconData& b)
+		{
+			if (a.distance == b.distance)
+			{
+				if (a.textureId == b.textureId)
+					return a.iconIdx < b.iconIdx;
+
+				return a.textureId < b.textureId;
+			}
+			else
+				return a.distance > b.distance;
+		};
+
+		// Insertion sort is close to linear on the almost sorted data we usually get. If the order changed a lot (e.g.
+		// the camera was rotated) give up and fall back to a regular sort.
+		UINT32 maxNumMoves = count * 8;
+		UINT32 numMoves = 0;
+
+		for (UINT32 i = 1; i < count; i++)
+		{
+			SortedIconData entry = mSortedIconData[i];
+
+			UINT32 j = i;
+			while (j > 0 && compare(entry, mSortedIconData[j - 1]))
+			{
+				mSortedIconData[j] = mSortedIconData[j - 1];
+				j--;
+				numMoves++;
+			}
+
+			mSortedIconData[j] = entry;
 
-		return nullptr;
+			if (numMoves > maxNumMoves)
+			{
+				std::sort(mSortedIconData.begin(), mSortedIconData.begin() + count, compare);
+				return;
+			}
+		}
 	}
 
 	void GizmoManager::limitIconSize(UINT32& width, UINT32& height)
@@ -977,47 +1352,51 @@ namespace bs
 	}
 
 	void GizmoRenderer::updateData(const SPtr<Camera>& camera, const Vector<GizmoManager::MeshRenderData>& meshes,
-		const SPtr<MeshBase>& iconMesh, const GizmoManager::IconRenderDataVecPtr& iconRenderData)
+		const SPtr<MeshBase>& iconMesh, const GizmoManager::IconRenderDataVecPtr& iconRenderData, bool updateMeshes)
 	{
 		mCamera = camera;
-		mMeshes = meshes;
 		mIconMesh = iconMesh;
 		mIconRenderData = iconRenderData;
 
-		// Allocate and assign GPU program parameter objects
-		UINT32 meshCounters[(UINT32)GizmoMeshType::Count];
-		bs_zero_out(meshCounters);
-
-		for (auto& meshData : mMeshes)
+		// Allocate and assign GPU program parameter objects. Mesh parameters stay valid if the meshes didn't change.
+		if (updateMeshes)
 		{
-			UINT32 typeIdx = (UINT32)meshData.type;
-			UINT32 paramsIdx = meshCounters[typeIdx];
+			mMeshes = meshes;
 
-			meshData.paramsIdx = paramsIdx;
+			UINT32 meshCounters[(UINT32)GizmoMeshType::Count];
+			bs_zero_out(meshCounters);
 
-			SPtr<GpuParamsSet> paramsSet;
-			if (paramsIdx >= mMeshParamSets[typeIdx].size())
+			for (auto& meshData : mMeshes)
 			{
-				paramsSet = mMeshMaterials[typeIdx]->createParamsSet();
-				mMeshMaterials[typeIdx]->updateParamsSet(paramsSet, true);
+				UINT32 typeIdx = (UINT32)meshData.type;
+				UINT32 paramsIdx = meshCounters[typeIdx];
 
-				paramsSet->setParamBlockBuffer("Uniforms", mMeshGizmoBuffer, true);
+				meshData.paramsIdx = paramsIdx;
 
-				mMeshParamSets[typeIdx].push_back(paramsSet);
-			}
-			else
-				paramsSet = mMeshParamSets[typeIdx][paramsIdx];
+				SPtr<GpuParamsSet> paramsSet;
+				if (paramsIdx >= mMeshParamSets[typeIdx].size())
+				{
+					paramsSet = mMeshMaterials[typeIdx]->createParamsSet();
+					mMeshMaterials[typeIdx]->updateParamsSet(paramsSet, true);
 
-			if(meshData.type == GizmoMeshType::Text)
-			{
-				SPtr<GpuParams> params = paramsSet->getGpuParams();
+					paramsSet->setParamBlockBuffer("Uniforms", mMeshGizmoBuffer, true);
 
-				GpuParamTexture textureParam;
-				params->getTextureParam(GPT_FRAGMENT_PROGRAM, "gMainTexture", textureParam);
-				textureParam.set(meshData.texture);
-			}
+					mMeshParamSets[typeIdx].push_back(paramsSet);
+				}
+				else
+					paramsSet = mMeshParamSets[typeIdx][paramsIdx];
+
+				if(meshData.type == GizmoMeshType::Text)
+				{
+					SPtr<GpuParams> params = paramsSet->getGpuParams();
 
-			meshCounters[typeIdx]++;
+					GpuParamTexture textureParam;
+					params->getTextureParam(GPT_FRAGMENT_PROGRAM, "gMainTexture", textureParam);
+					textureParam.set(meshData.texture);
+				}
+
+				meshCounters[typeIdx]++;
+			}
 		}
 
 		UINT32 iconMeshIdx = 0;
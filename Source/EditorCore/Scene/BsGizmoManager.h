@@ -11,6 +11,7 @@
 #include "Utility/BsDrawHelper.h"
 #include "Renderer/BsParamBlocks.h"
 #include "Renderer/BsRendererExtension.h"
+#include "Math/BsAABox.h"
 
 namespace bs
 {
@@ -56,6 +57,21 @@ namespace bs
 
 		 */
 		float iconSizeCull = 0.25f;
+
+		/** 
+		 * Maximum range at which gizmos other than icons will be rendered, in world units. Zero or negative values 
+		 * disable range culling.
+		 */
+		float shapeRange = 0.0f;
+	};
+
+	/** Number of gizmos that were rendered and culled during the last GizmoManager::update(). */
+	struct GizmoCullStats
+	{
+		UINT32 numShapesDrawn = 0;
+		UINT32 numShapesCulled = 0;
+		UINT32 numIconsDrawn = 0;
+		UINT32 numIconsCulled = 0;
 	};
 
 	/**
@@ -67,6 +83,13 @@ namespace bs
 	class BS_ED_EXPORT GizmoManager : public Module<GizmoManager>
 	{
 	public:
+		/** World space bounds of a pickable gizmo. */
+		struct PickableBounds
+		{
+			AABox bounds;
+			HSceneObject sceneObject;
+		};
+
 		GizmoManager();
 		~GizmoManager();
 
@@ -279,12 +302,17 @@ namespace bs
 		 */
 		HSceneObject getSceneObject(UINT32 gizmoIdx);
 
+		/** Returns the number of gizmos that were rendered and culled during the last call to update(). */
+		const GizmoCullStats& getCullStats() const { return mCullStats; }
+
 		/** @name Internal
 		 *  @{
 		 */
 
 		/**
-		 * Updates all the gizmo meshes to reflect all draw calls submitted since clearGizmos().
+		 * Updates all the gizmo meshes to reflect all draw calls submitted since clearGizmos(). Shape meshes are only
+		 * rebuilt if the submitted gizmos or the camera changed since the last update, otherwise the previously built
+		 * meshes are kept resident and only the icon mesh is regenerated.
 		 *
 		 * @note	Internal method.
 		 */
@@ -303,6 +331,16 @@ namespace bs
 		void renderForPicking(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
 			std::function<Color(UINT32)> idxToColorCallback);
 
+		/**
+		 * Calculates approximate world space bounds of all pickable gizmos, allowing them to be picked without 
+		 * rendering. Icons and frustums are represented by their origin point, and text is not included.
+		 *
+		 * @param[out]	output	Bounds of all pickable gizmos that have a scene object attached.
+		 *
+		 * @note	Internal method.
+		 */
+		void getPickableBounds(Vector<PickableBounds>& output) const;
+
 		/** @} */
 
 	private:
@@ -451,7 +489,9 @@ namespace bs
 		typedef SPtr<IconRenderDataVec> IconRenderDataVecPtr;
 
 		/**
-		 * Builds a brand new mesh that can be used for rendering all icon gizmos.
+		 * Builds a mesh that can be used for rendering all icon gizmos. Icon geometry is written into one of the dynamic
+		 * meshes from the icon mesh ring, so no new GPU resources are created unless the number of icons outgrows the
+		 * ring's capacity.
 		 *
 		 * @param[in]	camera			Camera the mesh will be rendered to.
 		 * @param[in]	drawSettings	Settings used to control icon drawing.
@@ -460,7 +500,8 @@ namespace bs
 		 * @param[in]	renderData		Output data that outlines the structure of the returned mesh. It tells us which 
 		 *								portions of the mesh use which icon texture.
 		 *
-		 * @return						A mesh containing all of the visible icons.	
+		 * @return						A mesh containing all of the visible icons, or null if no icons are visible. The 
+		 *								mesh may be larger than required, in which case only the beginning is used.
 		 */
 		SPtr<Mesh> buildIconMesh(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings,
 			const Vector<IconData>& iconData, bool forPicking, IconRenderDataVecPtr& renderData);
@@ -468,9 +509,41 @@ namespace bs
 		/**	Resizes the icon width/height so it is always scaled to optimal size (with preserved aspect). */
 		void limitIconSize(UINT32& width, UINT32& height);
 
+		/** 
+		 * Sorts the first @p count entries of mSortedIconData back to front, and then by texture. Expects the entries to
+		 * be in the order from the previous frame, in which case they are usually almost sorted already.
+		 */
+		void sortIcons(UINT32 count);
+
 		/** Converts mesh data from DrawHelper into mesh data usable by the gizmo renderer. */
 		Vector<MeshRenderData> createMeshProxyData(const Vector<DrawHelper::ShapeMeshData>& meshData);
 
+		/** 
+		 * Calculates a hash of all the non-icon gizmos submitted since the last call to clearGizmos(), and the draw settings
+		 * that affect them. Used for detecting if the shape meshes need to be rebuilt. Wire meshes are identified by their
+		 * vertex positions and indices.
+		 */
+		UINT64 calculateDrawHash(const GizmoDrawSettings& drawSettings) const;
+
+		/**
+		 * Records all non-icon gizmos that pass frustum and range culling into the provided draw helper.
+		 *
+		 * @param[in]	drawHelper			Draw helper to record the gizmos in. Any previously recorded shapes are cleared.
+		 * @param[in]	camera				Camera the gizmos will be rendered to.
+		 * @param[in]	drawSettings		Settings used to control gizmo drawing.
+		 * @param[in]	idxToColorCallback	If provided, only pickable gizmos are recorded, using the color returned by the
+		 *									callback for the gizmo's index instead of the gizmo color.
+		 * @param[out]	stats				Incremented by the number of recorded and culled gizmos.
+		 */
+		void recordShapes(DrawHelper& drawHelper, const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings,
+			const std::function<Color(UINT32)>& idxToColorCallback, GizmoCullStats& stats);
+
+		/** Returns the local space bounds of a cone gizmo. */
+		static AABox getConeBounds(const ConeData& data);
+
+		/** Returns the local space bounds of a frustum gizmo. */
+		static AABox getFrustumBounds(const FrustumData& data);
+
 		/**
 		 * Calculates colors for an icon based on its position in the camera. For example icons too close to too far might
 		 * be faded.
@@ -493,6 +566,8 @@ namespace bs
 		static const float MAX_ICON_RANGE;
 		static const UINT32 OPTIMAL_ICON_SIZE;
 		static const float ICON_TEXEL_WORLD_SIZE;
+		static const UINT32 ICON_MESH_RING_SIZE = 3;
+		static const UINT32 ICON_MESH_MIN_CAPACITY;
 
 		typedef Set<IconData, std::function<bool(const IconData&, const IconData&)>> IconSet;
 
@@ -526,6 +601,11 @@ namespace bs
 		Map<UINT32, HSceneObject> mIdxToSceneObjectMap;
 
 		Vector<DrawHelper::ShapeMeshData> mActiveMeshes;
+		UINT64 mActiveMeshesHash = 0;
+		const Camera* mActiveMeshesCamera = nullptr;
+		Matrix4 mActiveMeshesViewProj = Matrix4::IDENTITY;
+		bool mActiveMeshesDirty = true;
+		GizmoCullStats mCullStats;
 
 		SPtr<Mesh> mIconMesh;
 
@@ -534,15 +614,30 @@ namespace bs
 		// Immutable
 		SPtr<VertexDataDesc> mIconVertexDesc;
 
+		/** 
+		 * Set of dynamic meshes icon geometry is written to, used in round-robin fashion so the mesh written to in a
+		 * frame isn't the one the GPU might still be reading from a previous frame.
+		 */
+		struct IconMeshRing
+		{
+			SPtr<Mesh> meshes[ICON_MESH_RING_SIZE];
+			UINT32 capacities[ICON_MESH_RING_SIZE] = { };
+			UINT32 next = 0;
+		};
+
+		IconMeshRing mIconMeshRings[2]; // Normal, picking
+
 		// Transient
 		struct SortedIconData
 		{
 			float distance;
 			Vector2I screenPosition;
 			UINT32 iconIdx;
+			UINT64 textureId;
 		};
 
 		Vector<SortedIconData> mSortedIconData;
+		Vector<UINT32> mIconOrder[2]; // Normal, picking. Order of all icons after the last sort.
 	};
 
 	/** @} */
@@ -618,12 +713,15 @@ namespace bs
 		 * meshes on the sim thread.
 		 *
 		 * @param[in]	camera			Sets the camera all rendering will be performed to.
-		 * @param[in]	meshes			Meshes to render.
+		 * @param[in]	meshes			Meshes to render. Ignored if @p updateMeshes is false.
 		 * @param[in]	iconMesh		Mesh containing icon meshes.
 		 * @param[in]	iconRenderData	Icon render data outlining which parts of the icon mesh use which textures.
+		 * @param[in]	updateMeshes	If false the meshes provided by the previous call are kept and only the camera
+		 *								and icon data are updated.
 		 */
 		void updateData(const SPtr<Camera>& camera, const Vector<GizmoManager::MeshRenderData>& meshes, 
-			const SPtr<MeshBase>& iconMesh,  const GizmoManager::IconRenderDataVecPtr& iconRenderData);
+			const SPtr<MeshBase>& iconMesh,  const GizmoManager::IconRenderDataVecPtr& iconRenderData, 
+			bool updateMeshes);
 
 		static const float PICKING_ALPHA_CUTOFF;
 
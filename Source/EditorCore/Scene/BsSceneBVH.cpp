@@ -0,0 +1,343 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Scene/BsSceneBVH.h"
+#include "Math/BsRay.h"
+
+namespace bs
+{
+	/** Returns a box that encloses both of the provided boxes. */
+	static AABox mergeBounds(const AABox& a, const AABox& b)
+	{
+		const Vector3& minA = a.getMin();
+		const Vector3& maxA = a.getMax();
+		const Vector3& minB = b.getMin();
+		const Vector3& maxB = b.getMax();
+
+		return AABox(
+			Vector3(std::min(minA.x, minB.x), std::min(minA.y, minB.y), std::min(minA.z, minB.z)),
+			Vector3(std::max(maxA.x, maxB.x), std::max(maxA.y, maxB.y), std::max(maxA.z, maxB.z)));
+	}
+
+	/** Returns half the surface area of the box, used as the insertion cost metric. */
+	static float getHalfArea(const AABox& box)
+	{
+		Vector3 size = box.getMax() - box.getMin();
+		return size.x * size.y + size.y * size.z + size.z * size.x;
+	}
+
+	/** Checks if the box @p outer fully encloses the box @p inner. */
+	static bool enclosesBounds(const AABox& outer, const AABox& inner)
+	{
+		const Vector3& outerMin = outer.getMin();
+		const Vector3& outerMax = outer.getMax();
+		const Vector3& innerMin = inner.getMin();
+		const Vector3& innerMax = inner.getMax();
+
+		return outerMin.x <= innerMin.x && outerMin.y <= innerMin.y && outerMin.z <= innerMin.z &&
+			outerMax.x >= innerMax.x && outerMax.y >= innerMax.y && outerMax.z >= innerMax.z;
+	}
+
+	SceneBVH::SceneBVH(float margin)
+		:mMargin(margin)
+	{ }
+
+	UINT32 SceneBVH::insert(const AABox& bounds, UINT32 data)
+	{
+		Vector3 margin(mMargin, mMargin, mMargin);
+
+		UINT32 leafIdx = allocateNode();
+		mNodes[leafIdx].bounds = AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+		mNodes[leafIdx].data = data;
+
+		insertLeaf(leafIdx);
+		mNumLeaves++;
+
+		return leafIdx;
+	}
+
+	bool SceneBVH::update(UINT32 nodeIdx, const AABox& bounds)
+	{
+		if (enclosesBounds(mNodes[nodeIdx].bounds, bounds))
+			return false;
+
+		removeLeaf(nodeIdx);
+
+		Vector3 margin(mMargin, mMargin, mMargin);
+		mNodes[nodeIdx].bounds = AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+
+		insertLeaf(nodeIdx);
+		return true;
+	}
+
+	void SceneBVH::remove(UINT32 nodeIdx)
+	{
+		removeLeaf(nodeIdx);
+		freeNode(nodeIdx);
+
+		mNumLeaves--;
+	}
+
+	void SceneBVH::clear()
+	{
+		mNodes.clear();
+		mRoot = INVALID_NODE;
+		mFreeList = INVALID_NODE;
+		mNumLeaves = 0;
+	}
+
+	void SceneBVH::intersects(const Ray& ray, Vector<RayHit>& output) const
+	{
+		output.clear();
+
+		if (mRoot == INVALID_NODE)
+			return;
+
+		Vector<UINT32> todo;
+		todo.push_back(mRoot);
+
+		while (!todo.empty())
+		{
+			UINT32 nodeIdx = todo.back();
+			todo.pop_back();
+
+			const Node& node = mNodes[nodeIdx];
+
+			auto result = ray.intersects(node.bounds);
+			if (!result.first)
+				continue;
+
+			if (node.isLeaf())
+				output.push_back({ node.data, result.second });
+			else
+			{
+				todo.push_back(node.left);
+				todo.push_back(node.right);
+			}
+		}
+
+		std::sort(output.begin(), output.end(),
+			[](const RayHit& a, const RayHit& b)
+		{
+			return a.t < b.t;
+		});
+	}
+
+	void SceneBVH::intersects(const Vector<ClipPlane>& volume, Vector<UINT32>& output) const
+	{
+		output.clear();
+
+		if (mRoot == INVALID_NODE)
+			return;
+
+		// Second element signals the node is known to be fully inside the volume, in which case its children are not
+		// tested
+		Vector<std::pair<UINT32, bool>> todo;
+		todo.push_back(std::make_pair(mRoot, false));
+
+		while (!todo.empty())
+		{
+			UINT32 nodeIdx = todo.back().first;
+			bool inside = todo.back().second;
+			todo.pop_back();
+
+			const Node& node = mNodes[nodeIdx];
+
+			if (!inside)
+			{
+				VolumeOverlap overlap = classify(volume, node.bounds);
+				if (overlap == VolumeOverlap::Outside)
+					continue;
+
+				inside = overlap == VolumeOverlap::Inside;
+			}
+
+			if (node.isLeaf())
+				output.push_back(node.data);
+			else
+			{
+				todo.push_back(std::make_pair(node.left, inside));
+				todo.push_back(std::make_pair(node.right, inside));
+			}
+		}
+	}
+
+	bool SceneBVH::intersects(const Vector<ClipPlane>& volume, const AABox& box)
+	{
+		return classify(volume, box) != VolumeOverlap::Outside;
+	}
+
+	SceneBVH::VolumeOverlap SceneBVH::classify(const Vector<ClipPlane>& volume, const AABox& box)
+	{
+		const Vector3& min = box.getMin();
+		const Vector3& max = box.getMax();
+
+		bool inside = true;
+		for (auto& plane : volume)
+		{
+			// Corner furthest along the plane normal, and the one furthest against it
+			Vector3 positive(
+				plane.normal.x >= 0.0f ? max.x : min.x,
+				plane.normal.y >= 0.0f ? max.y : min.y,
+				plane.normal.z >= 0.0f ? max.z : min.z);
+
+			Vector3 negative(
+				plane.normal.x >= 0.0f ? min.x : max.x,
+				plane.normal.y >= 0.0f ? min.y : max.y,
+				plane.normal.z >= 0.0f ? min.z : max.z);
+
+			if (plane.normal.dot(positive) + plane.distance < 0.0f)
+				return VolumeOverlap::Outside;
+
+			if (plane.normal.dot(negative) + plane.distance < 0.0f)
+				inside = false;
+		}
+
+		return inside ? VolumeOverlap::Inside : VolumeOverlap::Intersects;
+	}
+
+	UINT32 SceneBVH::allocateNode()
+	{
+		UINT32 nodeIdx;
+		if (mFreeList != INVALID_NODE)
+		{
+			nodeIdx = mFreeList;
+			mFreeList = mNodes[nodeIdx].parent;
+		}
+		else
+		{
+			nodeIdx = (UINT32)mNodes.size();
+			mNodes.push_back(Node());
+		}
+
+		Node& node = mNodes[nodeIdx];
+		node.parent = INVALID_NODE;
+		node.left = INVALID_NODE;
+		node.right = INVALID_NODE;
+		node.data = 0;
+
+		return nodeIdx;
+	}
+
+	void SceneBVH::freeNode(UINT32 nodeIdx)
+	{
+		mNodes[nodeIdx].parent = mFreeList;
+		mFreeList = nodeIdx;
+	}
+
+	void SceneBVH::insertLeaf(UINT32 leafIdx)
+	{
+		if (mRoot == INVALID_NODE)
+		{
+			mRoot = leafIdx;
+			mNodes[leafIdx].parent = INVALID_NODE;
+			return;
+		}
+
+		// Find the best sibling by descending towards the child whose area grows the least
+		const AABox leafBounds = mNodes[leafIdx].bounds;
+
+		UINT32 siblingIdx = mRoot;
+		while (!mNodes[siblingIdx].isLeaf())
+		{
+			const Node& node = mNodes[siblingIdx];
+
+			float area = getHalfArea(node.bounds);
+			float combinedArea = getHalfArea(mergeBounds(node.bounds, leafBounds));
+
+			// Cost of creating a new parent for this node and the leaf
+			float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto getDescendCost = [&](UINT32 childIdx)
+			{
+				const Node& child = mNodes[childIdx];
+				float mergedArea = getHalfArea(mergeBounds(child.bounds, leafBounds));
+
+				if (child.isLeaf())
+					return mergedArea + inheritanceCost;
+
+				return (mergedArea - getHalfArea(child.bounds)) + inheritanceCost;
+			};
+
+			float leftCost = getDescendCost(node.left);
+			float rightCost = getDescendCost(node.right);
+
+			if (cost < leftCost && cost < rightCost)
+				break;
+
+			siblingIdx = leftCost < rightCost ? node.left : node.right;
+		}
+
+		// Create a new parent for the sibling and the leaf
+		UINT32 oldParentIdx = mNodes[siblingIdx].parent;
+		UINT32 newParentIdx = allocateNode();
+
+		Node& newParent = mNodes[newParentIdx];
+		newParent.parent = oldParentIdx;
+		newParent.bounds = mergeBounds(mNodes[siblingIdx].bounds, leafBounds);
+		newParent.left = siblingIdx;
+		newParent.right = leafIdx;
+
+		if (oldParentIdx != INVALID_NODE)
+		{
+			if (mNodes[oldParentIdx].left == siblingIdx)
+				mNodes[oldParentIdx].left = newParentIdx;
+			else
+				mNodes[oldParentIdx].right = newParentIdx;
+		}
+		else
+			mRoot = newParentIdx;
+
+		mNodes[siblingIdx].parent = newParentIdx;
+		mNodes[leafIdx].parent = newParentIdx;
+
+		refitAncestors(newParentIdx);
+	}
+
+	void SceneBVH::removeLeaf(UINT32 leafIdx)
+	{
+		if (leafIdx == mRoot)
+		{
+			mRoot = INVALID_NODE;
+			return;
+		}
+
+		// Replace the parent with the leaf's sibling
+		UINT32 parentIdx = mNodes[leafIdx].parent;
+		UINT32 grandParentIdx = mNodes[parentIdx].parent;
+		UINT32 siblingIdx = mNodes[parentIdx].left == leafIdx ? mNodes[parentIdx].right : mNodes[parentIdx].left;
+
+		if (grandParentIdx != INVALID_NODE)
+		{
+			if (mNodes[grandParentIdx].left == parentIdx)
+				mNodes[grandParentIdx].left = siblingIdx;
+			else
+				mNodes[grandParentIdx].right = siblingIdx;
+
+			mNodes[siblingIdx].parent = grandParentIdx;
+			refitAncestors(siblingIdx);
+		}
+		else
+		{
+			mRoot = siblingIdx;
+			mNodes[siblingIdx].parent = INVALID_NODE;
+		}
+
+		mNodes[leafIdx].parent = INVALID_NODE;
+		freeNode(parentIdx);
+	}
+
+	void SceneBVH::refitAncestors(UINT32 nodeIdx)
+	{
+		UINT32 curIdx = mNodes[nodeIdx].parent;
+		while (curIdx != INVALID_NODE)
+		{
+			Node& node = mNodes[curIdx];
+			node.bounds = mergeBounds(mNodes[node.left].bounds, mNodes[node.right].bounds);
+
+			curIdx = node.parent;
+		}
+	}
+}
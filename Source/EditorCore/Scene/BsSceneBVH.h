@@ -0,0 +1,144 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Math/BsAABox.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Editor-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Dynamic bounding volume hierarchy of axis aligned boxes. Each leaf stores a user provided identifier. Leaf bounds
+	 * are inflated by a small margin so objects that move slightly can be refit without changing the tree structure.
+	 */
+	class BS_ED_EXPORT SceneBVH
+	{
+	public:
+		/** Information about a leaf intersected by a ray. */
+		struct RayHit
+		{
+			UINT32 data;
+			float t;
+		};
+
+		/** 
+		 * Plane bounding a convex volume. Points for which normal.dot(point) + distance is non-negative lie on the
+		 * inner side of the plane.
+		 */
+		struct ClipPlane
+		{
+			Vector3 normal;
+			float distance;
+		};
+
+		/** Index used for signifying a non-existing node. */
+		static constexpr UINT32 INVALID_NODE = (UINT32)-1;
+
+		/**
+		 * Constructs a new hierarchy.
+		 *
+		 * @param[in]	margin	Distance by which to inflate the bounds of each leaf.
+		 */
+		SceneBVH(float margin = 0.1f);
+
+		/**
+		 * Inserts a new leaf into the hierarchy.
+		 *
+		 * @param[in]	bounds	World space bounds of the object.
+		 * @param[in]	data	User provided identifier of the object.
+		 * @return				Index of the leaf node, to be used with update() and remove().
+		 */
+		UINT32 insert(const AABox& bounds, UINT32 data);
+
+		/**
+		 * Updates the bounds of an existing leaf. If the new bounds fit in the inflated leaf bounds the tree is left
+		 * as is, otherwise the leaf is re-inserted.
+		 *
+		 * @param[in]	nodeIdx		Index of the leaf node, as returned by insert().
+		 * @param[in]	bounds		New world space bounds of the object.
+		 * @return					True if the tree structure was modified.
+		 */
+		bool update(UINT32 nodeIdx, const AABox& bounds);
+
+		/** Removes a leaf previously added with insert(). */
+		void remove(UINT32 nodeIdx);
+
+		/** Removes all nodes from the hierarchy. */
+		void clear();
+
+		/**
+		 * Finds all leaves whose bounds are intersected by the provided ray.
+		 *
+		 * @param[in]	ray		Ray to test, in world space.
+		 * @param[out]	output	Information about every intersected leaf, sorted by distance along the ray.
+		 */
+		void intersects(const Ray& ray, Vector<RayHit>& output) const;
+
+		/**
+		 * Finds all leaves whose bounds intersect the provided convex volume. Since leaf bounds are inflated the caller
+		 * should test the actual object bounds if exact results are required.
+		 *
+		 * @param[in]	volume	Planes bounding the volume, in world space.
+		 * @param[out]	output	User provided identifiers of all leaves intersecting the volume, in no particular order.
+		 */
+		void intersects(const Vector<ClipPlane>& volume, Vector<UINT32>& output) const;
+
+		/** Checks if a box intersects a convex volume. */
+		static bool intersects(const Vector<ClipPlane>& volume, const AABox& box);
+
+		/** Returns the user provided identifier of a leaf. */
+		UINT32 getData(UINT32 nodeIdx) const { return mNodes[nodeIdx].data; }
+
+		/** Returns the number of leaves in the hierarchy. */
+		UINT32 getNumLeaves() const { return mNumLeaves; }
+
+	private:
+		/** A single node in the hierarchy. Leaves have no children and internal nodes have no data. */
+		struct Node
+		{
+			AABox bounds;
+			UINT32 parent = INVALID_NODE; // Doubles as the next free node when the node is not in use
+			UINT32 left = INVALID_NODE;
+			UINT32 right = INVALID_NODE;
+			UINT32 data = 0;
+
+			bool isLeaf() const { return left == INVALID_NODE; }
+		};
+
+		/** Relation of a box to a convex volume. */
+		enum class VolumeOverlap
+		{
+			Outside, Intersects, Inside
+		};
+
+		/** Determines if a box is fully inside, fully outside or partially inside a convex volume. */
+		static VolumeOverlap classify(const Vector<ClipPlane>& volume, const AABox& box);
+
+		/** Retrieves a node from the free list, or allocates a new one. */
+		UINT32 allocateNode();
+
+		/** Returns a node to the free list. */
+		void freeNode(UINT32 nodeIdx);
+
+		/** Inserts an existing leaf node into the tree. */
+		void insertLeaf(UINT32 leafIdx);
+
+		/** Removes a leaf node from the tree without freeing it. */
+		void removeLeaf(UINT32 leafIdx);
+
+		/** Recalculates the bounds of all the ancestors of the provided node. */
+		void refitAncestors(UINT32 nodeIdx);
+
+		Vector<Node> mNodes;
+		UINT32 mRoot = INVALID_NODE;
+		UINT32 mFreeList = INVALID_NODE;
+		UINT32 mNumLeaves = 0;
+		float mMargin;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,226 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Scene/BsSceneBoundsCache.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsSceneChangeNotifier.h"
+
+using namespace std::placeholders;
+
+namespace bs
+{
+	SceneBoundsCache::SceneBoundsCache()
+	{
+		mObjectChangedConn = SceneChangeNotifier::instance().onObjectChanged.connect(
+			std::bind(&SceneBoundsCache::onObjectChanged, this, _1));
+		mSceneChangedConn = SceneChangeNotifier::instance().onSceneChanged.connect(
+			std::bind(&SceneBoundsCache::clear, this));
+	}
+
+	SceneBoundsCache::~SceneBoundsCache()
+	{
+		mObjectChangedConn.disconnect();
+		mSceneChangedConn.disconnect();
+	}
+
+	bool SceneBoundsCache::getBounds(const HSceneObject& sceneObject, AABox& bounds)
+	{
+		if (sceneObject.isDestroyed())
+			return false;
+
+		const Entry& entry = getEntry(sceneObject);
+		if (!entry.hasBounds)
+			return false;
+
+		bounds = entry.bounds;
+		return true;
+	}
+
+	bool SceneBoundsCache::getHierarchyBounds(const Vector<HSceneObject>& sceneObjects, AABox& bounds)
+	{
+		// Merging is idempotent, so hierarchies contained in other provided hierarchies don't need special handling
+		bool foundOne = false;
+		for (auto& root : sceneObjects)
+		{
+			if (root.isDestroyed())
+				continue;
+
+			const Entry& entry = getHierarchyEntry(root);
+			if (!entry.hasHierarchyBounds)
+				continue;
+
+			if (!foundOne)
+			{
+				bounds = entry.hierarchyBounds;
+				foundOne = true;
+			}
+			else
+				bounds.merge(entry.hierarchyBounds);
+		}
+
+		return foundOne;
+	}
+
+	void SceneBoundsCache::forEachInHierarchy(const Vector<HSceneObject>& sceneObjects,
+		const std::function<void(const HSceneObject&, const AABox*)>& callback)
+	{
+		UnorderedSet<UINT64> visited;
+		Vector<HSceneObject> todo;
+
+		for (auto& root : sceneObjects)
+		{
+			if (root.isDestroyed())
+				continue;
+
+			todo.push_back(root);
+			while (!todo.empty())
+			{
+				HSceneObject so = todo.back();
+				todo.pop_back();
+
+				// Skip objects that are part of an already visited hierarchy
+				if (!visited.insert(so->getInstanceId()).second)
+					continue;
+
+				const Entry& entry = getEntry(so);
+				callback(so, entry.hasBounds ? &entry.bounds : nullptr);
+
+				UINT32 numChildren = so->getNumChildren();
+				for (UINT32 i = 0; i < numChildren; i++)
+					todo.push_back(so->getChild(i));
+			}
+		}
+	}
+
+	void SceneBoundsCache::clear()
+	{
+		mEntries.clear();
+	}
+
+	SceneBoundsCache::Entry& SceneBoundsCache::getEntry(const HSceneObject& sceneObject)
+	{
+		auto iterFind = mEntries.find(sceneObject->getInstanceId());
+		if (iterFind != mEntries.end())
+			return iterFind->second;
+
+		Entry& entry = mEntries[sceneObject->getInstanceId()];
+		entry.bounds = AABox(Vector3::ZERO, Vector3::ZERO);
+
+		const Vector<HComponent>& components = sceneObject->getComponents();
+		for (auto& component : components)
+		{
+			Bounds curBounds;
+			if (component->calculateBounds(curBounds))
+			{
+				if (!entry.hasBounds)
+				{
+					entry.bounds = curBounds.getBox();
+					entry.hasBounds = true;
+				}
+				else
+					entry.bounds.merge(curBounds.getBox());
+			}
+		}
+
+		return entry;
+	}
+
+	const SceneBoundsCache::Entry& SceneBoundsCache::getHierarchyEntry(const HSceneObject& sceneObject)
+	{
+		struct StackElem
+		{
+			StackElem(const HSceneObject& sceneObject)
+				:sceneObject(sceneObject)
+			{ }
+
+			HSceneObject sceneObject;
+			bool childrenQueued = false;
+		};
+
+		// Note: Lookups can insert new entries, but references to existing map elements stay valid
+		Entry& rootEntry = getEntry(sceneObject);
+		if (rootEntry.hierarchyValid)
+			return rootEntry;
+
+		// Children need to be aggregated before their parents, so each object is visited twice: first to queue its
+		// children, and then to merge their bounds once they have been processed
+		Vector<StackElem> todo;
+		todo.push_back(StackElem(sceneObject));
+
+		while (!todo.empty())
+		{
+			HSceneObject so = todo.back().sceneObject;
+			UINT32 numChildren = so->getNumChildren();
+
+			if (!todo.back().childrenQueued)
+			{
+				todo.back().childrenQueued = true;
+
+				for (UINT32 i = 0; i < numChildren; i++)
+				{
+					HSceneObject child = so->getChild(i);
+					if (!getEntry(child).hierarchyValid)
+						todo.push_back(StackElem(child));
+				}
+
+				continue;
+			}
+
+			todo.pop_back();
+
+			Entry& entry = getEntry(so);
+			AABox hierarchyBounds = entry.bounds;
+			bool hasHierarchyBounds = entry.hasBounds;
+
+			for (UINT32 i = 0; i < numChildren; i++)
+			{
+				const Entry& childEntry = getEntry(so->getChild(i));
+				if (!childEntry.hasHierarchyBounds)
+					continue;
+
+				if (!hasHierarchyBounds)
+				{
+					hierarchyBounds = childEntry.hierarchyBounds;
+					hasHierarchyBounds = true;
+				}
+				else
+					hierarchyBounds.merge(childEntry.hierarchyBounds);
+			}
+
+			entry.hierarchyBounds = hierarchyBounds;
+			entry.hasHierarchyBounds = hasHierarchyBounds;
+			entry.hierarchyValid = true;
+		}
+
+		return rootEntry;
+	}
+
+	void SceneBoundsCache::onObjectChanged(const HSceneObject& sceneObject)
+	{
+		// World transforms of all children depend on the object, so their bounds need to be recalculated
+		Vector<HSceneObject> todo;
+		todo.push_back(sceneObject);
+
+		while (!todo.empty())
+		{
+			HSceneObject so = todo.back();
+			todo.pop_back();
+
+			mEntries.erase(so->getInstanceId());
+
+			UINT32 numChildren = so->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push_back(so->getChild(i));
+		}
+
+		// Ancestors keep the bounds of their own components, but their aggregated hierarchy bounds are now out of date
+		HSceneObject parent = sceneObject->getParent();
+		while (parent != nullptr)
+		{
+			auto iterFind = mEntries.find(parent->getInstanceId());
+			if (iterFind != mEntries.end())
+				iterFind->second.hierarchyValid = false;
+
+			parent = parent->getParent();
+		}
+	}
+}
@@ -0,0 +1,86 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Math/BsAABox.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Editor-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Caches world space bounds of scene object components (e.g. Renderable), so editor operations like framing or
+	 * handle placement don't need to recalculate them every time. Bounds of whole hierarchies are aggregated from the
+	 * bounds of their children and cached as well.
+	 *
+	 * Cached bounds are invalidated through SceneChangeNotifier. Modifying an object invalidates the bounds of its 
+	 * hierarchy and the aggregated bounds of its ancestors, while scene-wide modifications discard all cached bounds.
+	 */
+	class BS_ED_EXPORT SceneBoundsCache : public Module<SceneBoundsCache>
+	{
+		/** Cached bounds of a single scene object. */
+		struct Entry
+		{
+			AABox bounds;
+			AABox hierarchyBounds;
+			bool hasBounds = false;
+			bool hasHierarchyBounds = false;
+			bool hierarchyValid = false;
+		};
+
+	public:
+		SceneBoundsCache();
+		~SceneBoundsCache();
+
+		/**
+		 * Returns world space bounds of all the components on the provided scene object, not including its children.
+		 *
+		 * @param[in]	sceneObject		Object to retrieve the bounds for.
+		 * @param[out]	bounds			Bounds of the object's components. Only valid if the method returns true.
+		 * @return						True if the object has at least one component with bounds.
+		 */
+		bool getBounds(const HSceneObject& sceneObject, AABox& bounds);
+
+		/**
+		 * Returns world space bounds enclosing the components of all the provided scene objects and their children.
+		 *
+		 * @param[in]	sceneObjects	Root objects of the hierarchies to retrieve the bounds for.
+		 * @param[out]	bounds			Merged bounds of all the components. Only valid if the method returns true.
+		 * @return						True if at least one component with bounds was found.
+		 */
+		bool getHierarchyBounds(const Vector<HSceneObject>& sceneObjects, AABox& bounds);
+
+		/**
+		 * Calls the provided callback for every unique scene object in the provided hierarchies, along with its cached
+		 * bounds.
+		 */
+		void forEachInHierarchy(const Vector<HSceneObject>& sceneObjects,
+			const std::function<void(const HSceneObject&, const AABox*)>& callback);
+
+		/** Discards all cached bounds. */
+		void clear();
+
+	private:
+		/** Returns the cache entry for the provided object, calculating the bounds of its components if needed. */
+		Entry& getEntry(const HSceneObject& sceneObject);
+
+		/** Returns the cache entry for the provided object, with up-to-date bounds of its whole hierarchy. */
+		const Entry& getHierarchyEntry(const HSceneObject& sceneObject);
+
+		/** 
+		 * Triggered by SceneChangeNotifier when a specific scene object was modified. Discards the entries of the 
+		 * object's hierarchy, and the aggregated hierarchy bounds of its ancestors.
+		 */
+		void onObjectChanged(const HSceneObject& sceneObject);
+
+		UnorderedMap<UINT64, Entry> mEntries;
+		HEvent mObjectChangedConn;
+		HEvent mSceneChangedConn;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,41 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Scene/BsSceneChangeNotifier.h"
+#include "UndoRedo/BsUndoRedo.h"
+#include "Resources/BsResources.h"
+
+namespace bs
+{
+	SceneChangeNotifier::SceneChangeNotifier()
+	{
+		// Undo/redo commands don't report which objects they affect
+		mUndoRedoConn = UndoRedo::instance().onStackChanged.connect(
+			std::bind(&SceneChangeNotifier::notifySceneChanged, this));
+
+		// Meshes or other resources referenced by the scene might have been reimported
+		mResourceModifiedConn = gResources().onResourceModified.connect(
+			[this](const HResource&) { notifySceneChanged(); });
+	}
+
+	SceneChangeNotifier::~SceneChangeNotifier()
+	{
+		mUndoRedoConn.disconnect();
+		mResourceModifiedConn.disconnect();
+	}
+
+	void SceneChangeNotifier::notifyObjectChanged(const HSceneObject& sceneObject)
+	{
+		if (sceneObject.isDestroyed())
+		{
+			notifySceneChanged();
+			return;
+		}
+
+		onObjectChanged(sceneObject);
+	}
+
+	void SceneChangeNotifier::notifySceneChanged()
+	{
+		onSceneChanged();
+	}
+}
@@ -0,0 +1,51 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Utility/BsEvent.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Editor-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Central place through which the editor reports modifications to the scene, allowing editor systems to keep data
+	 * they derive from the scene (e.g. picking or bounds acceleration structures) up to date without having to scan the
+	 * scene every frame.
+	 *
+	 * Modifications are reported either for specific scene objects (e.g. objects moved using a handle), or as a
+	 * scene-wide change when the exact set of modified objects isn't known (e.g. an undo operation, a scene load, a
+	 * modified resource or a running game).
+	 */
+	class BS_ED_EXPORT SceneChangeNotifier : public Module<SceneChangeNotifier>
+	{
+	public:
+		SceneChangeNotifier();
+		~SceneChangeNotifier();
+
+		/**
+		 * Notifies listeners that the provided scene object, its components or its children were modified, or that the
+		 * object was added to the scene.
+		 */
+		void notifyObjectChanged(const HSceneObject& sceneObject);
+
+		/** Notifies listeners that any part of the scene might have been modified. */
+		void notifySceneChanged();
+
+		/** Triggered when a scene object, its components or its children were modified. */
+		Event<void(const HSceneObject&)> onObjectChanged;
+
+		/** Triggered when any part of the scene might have been modified. */
+		Event<void()> onSceneChanged;
+
+	private:
+		HEvent mUndoRedoConn;
+		HEvent mResourceModifiedConn;
+	};
+
+	/** @} */
+}
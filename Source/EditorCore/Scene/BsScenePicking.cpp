@@ -25,6 +25,10 @@
 #include "Renderer/BsRenderer.h"
 #include "Scene/BsGizmoManager.h"
 #include "Renderer/BsRendererUtility.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Math/BsRay.h"
+#include "Scene/BsSceneChangeNotifier.h"
 
 using namespace std::placeholders;
 
@@ -44,16 +48,27 @@ namespace bs
 		}
 
 		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::initialize, mCore));
+
+		mObjectChangedConn = SceneChangeNotifier::instance().onObjectChanged.connect(
+			std::bind(&ScenePicking::onObjectChanged, this, _1));
+		mSceneChangedConn = SceneChangeNotifier::instance().onSceneChanged.connect(
+			std::bind(&ScenePicking::onSceneChanged, this));
 	}
 
 	ScenePicking::~ScenePicking()
 	{
+		mObjectChangedConn.disconnect();
+		mSceneChangedConn.disconnect();
+
 		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::destroy, mCore));
 	}
 
 	HSceneObject ScenePicking::pickClosestObject(const SPtr<Camera>& cam, const GizmoDrawSettings& gizmoDrawSettings,
 		const Vector2I& position, const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, SnapData* data)
 	{
+		if (mBackend == ScenePickingBackend::CPU)
+			return pickClosestObjectCPU(cam, position, area, ignoreRenderables, data);
+
 		Vector<HSceneObject> selectedObjects = pickObjects(cam, gizmoDrawSettings, position, area, ignoreRenderables, data);
 		if (selectedObjects.empty())
 			return HSceneObject();
@@ -71,6 +86,20 @@ namespace bs
 	Vector<HSceneObject> ScenePicking::pickObjects(const SPtr<Camera>& cam, const GizmoDrawSettings& gizmoDrawSettings,
 		const Vector2I& position, const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, SnapData* data)
 	{
+		if (mAreaPickingMode == AreaPickingMode::Bounds && (area.x > 1 || area.y > 1))
+			return pickObjectsInArea(cam, position, area, ignoreRenderables);
+
+		if (mBackend == ScenePickingBackend::CPU)
+		{
+			Vector<HSceneObject> results;
+
+			HSceneObject so = pickClosestObjectCPU(cam, position, area, ignoreRenderables, data);
+			if (so)
+				results.push_back(so);
+
+			return results;
+		}
+
 		auto comparePickElement = [&] (const ScenePicking::RenderablePickData& a, const ScenePicking::RenderablePickData& b)
 		{
 			// Sort by alpha setting first, then by cull mode, then by index
@@ -207,6 +236,442 @@ namespace bs
 		return results;
 	}
 
+	HSceneObject ScenePicking::pickClosestObjectCPU(const SPtr<Camera>& cam, const Vector2I& position, 
+		const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, SnapData* data)
+	{
+		updateBVH();
+
+		Vector2I center(position.x + area.x / 2, position.y + area.y / 2);
+		Ray ray = cam->screenPointToRay(center);
+
+		Vector<SceneBVH::RayHit> hits;
+		mBVH.intersects(ray, hits);
+
+		HSceneObject closestObject;
+		float closestDistance = std::numeric_limits<float>::infinity();
+		Vector3 closestNormal;
+
+		for (auto& hit : hits)
+		{
+			// Hits are sorted by distance to their bounds, so no further hit can be closer
+			if (hit.t > closestDistance)
+				break;
+
+			const RenderableBVHData& entry = mBVHRenderables[hit.data];
+			if (entry.renderable.isDestroyed() || !entry.mesh.isLoaded())
+				continue;
+
+			HSceneObject so = entry.renderable->SO();
+
+			auto iterFind = std::find(ignoreRenderables.begin(), ignoreRenderables.end(), so);
+			if (iterFind != ignoreRenderables.end())
+				continue;
+
+			float distance;
+			Vector3 normal;
+			if (intersectsRenderable(entry, ray, distance, normal) && distance < closestDistance)
+			{
+				closestObject = so;
+				closestDistance = distance;
+				closestNormal = normal;
+			}
+		}
+
+		if (closestObject && data != nullptr)
+		{
+			data->pickPosition = ray.getPoint(closestDistance);
+			data->normal = closestNormal;
+		}
+
+		return closestObject;
+	}
+
+	bool ScenePicking::intersectsRenderable(const RenderableBVHData& entry, const Ray& ray, float& distance, 
+		Vector3& normal) const
+	{
+		SPtr<MeshData> meshData = entry.mesh->getCachedData();
+		if (meshData == nullptr)
+		{
+			Bounds worldBounds = entry.mesh->getProperties().getBounds();
+			worldBounds.transformAffine(entry.worldTransform);
+
+			auto result = ray.intersects(worldBounds.getBox());
+			if (!result.first)
+				return false;
+
+			distance = result.second;
+			normal = -ray.getDirection();
+			return true;
+		}
+
+		Matrix4 invWorldTransform = entry.worldTransform.inverseAffine();
+
+		Ray localRay = ray;
+		localRay.transformAffine(invWorldTransform);
+
+		const Vector3& origin = localRay.getOrigin();
+		const Vector3& direction = localRay.getDirection();
+
+		// Positions aren't necessarily in the first vertex stream
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+
+		const VertexElement* positionElement = nullptr;
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			if (element.getSemantic() == VES_POSITION && element.getSemanticIdx() == 0)
+			{
+				positionElement = &element;
+				break;
+			}
+		}
+
+		if (positionElement == nullptr || positionElement->getType() == VET_FLOAT2)
+			return false;
+
+		UINT32 streamIdx = positionElement->getStreamIdx();
+		UINT8* positions = meshData->getElementData(VES_POSITION, 0, streamIdx);
+		UINT32 stride = vertexDesc->getVertexStride(streamIdx);
+		UINT32* indices32 = meshData->getIndexType() == IT_32BIT ? meshData->getIndices32() : nullptr;
+		UINT16* indices16 = meshData->getIndexType() == IT_16BIT ? meshData->getIndices16() : nullptr;
+
+		auto getPosition = [&](UINT32 idx)
+		{
+			UINT32 vertIdx = indices32 != nullptr ? indices32[idx] : indices16[idx];
+			return *(Vector3*)(positions + vertIdx * stride);
+		};
+
+		float closestT = std::numeric_limits<float>::infinity();
+		Vector3 closestNormal;
+
+		const MeshProperties& meshProps = entry.mesh->getProperties();
+		for (UINT32 i = 0; i < meshProps.getNumSubMeshes(); i++)
+		{
+			const SubMesh& subMesh = meshProps.getSubMesh(i);
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+				continue;
+
+			UINT32 indexEnd = subMesh.indexOffset + subMesh.indexCount;
+			for (UINT32 j = subMesh.indexOffset; j + 2 < indexEnd; j += 3)
+			{
+				Vector3 a = getPosition(j);
+				Vector3 b = getPosition(j + 1);
+				Vector3 c = getPosition(j + 2);
+
+				// Moller-Trumbore, tests both triangle sides
+				Vector3 edge1 = b - a;
+				Vector3 edge2 = c - a;
+
+				Vector3 p = direction.cross(edge2);
+				float det = edge1.dot(p);
+				if (Math::abs(det) < 1e-8f)
+					continue;
+
+				float invDet = 1.0f / det;
+				Vector3 s = origin - a;
+
+				float u = s.dot(p) * invDet;
+				if (u < 0.0f || u > 1.0f)
+					continue;
+
+				Vector3 q = s.cross(edge1);
+				float v = direction.dot(q) * invDet;
+				if (v < 0.0f || (u + v) > 1.0f)
+					continue;
+
+				float t = edge2.dot(q) * invDet;
+				if (t >= 0.0f && t < closestT)
+				{
+					closestT = t;
+					closestNormal = edge1.cross(edge2);
+				}
+			}
+		}
+
+		if (closestT == std::numeric_limits<float>::infinity())
+			return false;
+
+		// Transform the results back to world space
+		Vector3 worldPoint = entry.worldTransform.multiplyAffine(localRay.getPoint(closestT));
+		distance = (worldPoint - ray.getOrigin()).length();
+
+		normal = invWorldTransform.transpose().multiplyDirection(closestNormal);
+		normal.normalize();
+
+		if (normal.dot(ray.getDirection()) > 0.0f)
+			normal = -normal;
+
+		return true;
+	}
+
+	Vector<HSceneObject> ScenePicking::pickObjectsInArea(const SPtr<Camera>& cam, const Vector2I& position, 
+		const Vector2I& area, Vector<HSceneObject>& ignoreRenderables)
+	{
+		updateBVH();
+
+		Vector<SceneBVH::ClipPlane> volume = createAreaVolume(cam, position, area);
+
+		Vector<UINT32> renderableSlots;
+		mBVH.intersects(volume, renderableSlots);
+
+		Vector<GizmoManager::PickableBounds> gizmoBounds;
+		GizmoManager::instance().getPickableBounds(gizmoBounds);
+
+		// Ignored objects are pre-marked as visited, so they get skipped along with duplicates
+		UnorderedSet<UINT64> visited;
+		for (auto& so : ignoreRenderables)
+		{
+			if (so)
+				visited.insert(so->getInstanceId());
+		}
+
+		struct PickedObject
+		{
+			HSceneObject so;
+			float distance;
+		};
+
+		Vector3 cameraPosition = cam->getTransform().getPosition();
+		Vector<PickedObject> pickedObjects;
+
+		auto tryAddObject = [&](const HSceneObject& so, const AABox& bounds)
+		{
+			if (visited.find(so->getInstanceId()) != visited.end())
+				return;
+
+			if (!SceneBVH::intersects(volume, bounds))
+				return;
+
+			visited.insert(so->getInstanceId());
+			pickedObjects.push_back({ so, cameraPosition.squaredDistance(bounds.getCenter()) });
+		};
+
+		for (auto& slot : renderableSlots)
+		{
+			const RenderableBVHData& entry = mBVHRenderables[slot];
+			if (entry.renderable.isDestroyed() || !entry.mesh.isLoaded())
+				continue;
+
+			// BVH leaves are inflated, so test the actual bounds
+			Bounds worldBounds = entry.mesh->getProperties().getBounds();
+			worldBounds.transformAffine(entry.worldTransform);
+
+			tryAddObject(entry.renderable->SO(), worldBounds.getBox());
+		}
+
+		for (auto& entry : gizmoBounds)
+			tryAddObject(entry.sceneObject, entry.bounds);
+
+		std::sort(pickedObjects.begin(), pickedObjects.end(),
+			[](const PickedObject& a, const PickedObject& b)
+		{
+			return a.distance < b.distance;
+		});
+
+		Vector<HSceneObject> results;
+		results.reserve(pickedObjects.size());
+
+		for (auto& entry : pickedObjects)
+			results.push_back(entry.so);
+
+		return results;
+	}
+
+	Vector<SceneBVH::ClipPlane> ScenePicking::createAreaVolume(const SPtr<Camera>& cam, const Vector2I& position,
+		const Vector2I& area)
+	{
+		Vector2I max(position.x + std::max(area.x, 1), position.y + std::max(area.y, 1));
+
+		Ray corners[4] =
+		{
+			cam->screenPointToRay(Vector2I(position.x, position.y)),
+			cam->screenPointToRay(Vector2I(max.x, position.y)),
+			cam->screenPointToRay(Vector2I(max.x, max.y)),
+			cam->screenPointToRay(Vector2I(position.x, max.y))
+		};
+
+		Ray centerRay = cam->screenPointToRay(Vector2I((position.x + max.x) / 2, (position.y + max.y) / 2));
+		Vector3 insidePoint = centerRay.getPoint(1.0f);
+
+		Vector<SceneBVH::ClipPlane> volume;
+		volume.reserve(5);
+
+		// Side planes, each going through two neighboring corner rays. Using the ray origins and a point along each ray
+		// ensures this works for both perspective (shared origin) and orthographic (shared direction) cameras.
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			const Ray& a = corners[i];
+			const Ray& b = corners[(i + 1) % 4];
+
+			Vector3 p0 = a.getOrigin();
+			Vector3 p1 = a.getPoint(1.0f);
+			Vector3 p2 = b.getPoint(1.0f);
+
+			Vector3 normal = (p1 - p0).cross(p2 - p0);
+			if (normal.squaredLength() < 1e-12f)
+				continue;
+
+			normal.normalize();
+
+			SceneBVH::ClipPlane plane = { normal, -normal.dot(p0) };
+			if (plane.normal.dot(insidePoint) + plane.distance < 0.0f)
+				plane = { -plane.normal, -plane.distance };
+
+			volume.push_back(plane);
+		}
+
+		// Near plane
+		Vector3 nearNormal = centerRay.getDirection();
+		volume.push_back({ nearNormal, -nearNormal.dot(centerRay.getOrigin()) });
+
+		return volume;
+	}
+
+	void ScenePicking::updateBVH()
+	{
+		if (mBVHFullSyncRequired)
+		{
+			mBVHFullSyncRequired = false;
+			mDirtyBVHObjects.clear();
+			mBVHSyncIdx++;
+
+			Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
+			for (auto& renderable : renderables)
+				syncBVHRenderable(renderable);
+
+			// Remove renderables that were destroyed or lost their mesh
+			for (auto iter = mBVHLookup.begin(); iter != mBVHLookup.end();)
+			{
+				UINT32 slot = iter->second;
+				if (mBVHRenderables[slot].syncIdx == mBVHSyncIdx)
+				{
+					++iter;
+					continue;
+				}
+
+				iter = mBVHLookup.erase(iter);
+				removeBVHRenderable(slot);
+			}
+
+			return;
+		}
+
+		if (mDirtyBVHObjects.empty())
+			return;
+
+		mBVHSyncIdx++;
+
+		Vector<HSceneObject> todo;
+		for (auto& entry : mDirtyBVHObjects)
+		{
+			const HSceneObject& dirtyObject = entry.second;
+			if (dirtyObject.isDestroyed())
+				continue;
+
+			todo.push_back(dirtyObject);
+			while (!todo.empty())
+			{
+				HSceneObject so = todo.back();
+				todo.pop_back();
+
+				for (auto& component : so->getComponents())
+				{
+					if (rtti_is_of_type<CRenderable>(component.get()))
+						syncBVHRenderable(static_object_cast<CRenderable>(component));
+				}
+
+				UINT32 numChildren = so->getNumChildren();
+				for (UINT32 i = 0; i < numChildren; i++)
+					todo.push_back(so->getChild(i));
+			}
+		}
+
+		mDirtyBVHObjects.clear();
+	}
+
+	void ScenePicking::syncBVHRenderable(const HRenderable& renderable)
+	{
+		UINT64 instanceId = renderable->getInstanceId();
+		auto iterFind = mBVHLookup.find(instanceId);
+
+		HMesh mesh = renderable->getMesh();
+		if (!mesh.isLoaded())
+		{
+			if (iterFind != mBVHLookup.end())
+			{
+				UINT32 slot = iterFind->second;
+				mBVHLookup.erase(iterFind);
+				removeBVHRenderable(slot);
+			}
+
+			return;
+		}
+
+		Matrix4 worldTransform = renderable->SO()->getWorldMatrix();
+		if (iterFind == mBVHLookup.end())
+		{
+			UINT32 slot;
+			if (!mFreeBVHSlots.empty())
+			{
+				slot = mFreeBVHSlots.back();
+				mFreeBVHSlots.pop_back();
+			}
+			else
+			{
+				slot = (UINT32)mBVHRenderables.size();
+				mBVHRenderables.push_back(RenderableBVHData());
+			}
+
+			Bounds worldBounds = mesh->getProperties().getBounds();
+			worldBounds.transformAffine(worldTransform);
+
+			RenderableBVHData& entry = mBVHRenderables[slot];
+			entry.renderable = renderable;
+			entry.mesh = mesh;
+			entry.worldTransform = worldTransform;
+			entry.nodeIdx = mBVH.insert(worldBounds.getBox(), slot);
+			entry.syncIdx = mBVHSyncIdx;
+
+			mBVHLookup[instanceId] = slot;
+		}
+		else
+		{
+			RenderableBVHData& entry = mBVHRenderables[iterFind->second];
+			if (entry.worldTransform != worldTransform || entry.mesh != mesh)
+			{
+				Bounds worldBounds = mesh->getProperties().getBounds();
+				worldBounds.transformAffine(worldTransform);
+
+				entry.mesh = mesh;
+				entry.worldTransform = worldTransform;
+				mBVH.update(entry.nodeIdx, worldBounds.getBox());
+			}
+
+			entry.syncIdx = mBVHSyncIdx;
+		}
+	}
+
+	void ScenePicking::removeBVHRenderable(UINT32 slot)
+	{
+		RenderableBVHData& entry = mBVHRenderables[slot];
+
+		mBVH.remove(entry.nodeIdx);
+		mFreeBVHSlots.push_back(slot);
+		entry = RenderableBVHData();
+	}
+
+	void ScenePicking::onObjectChanged(const HSceneObject& sceneObject)
+	{
+		if (!mBVHFullSyncRequired)
+			mDirtyBVHObjects[sceneObject->getInstanceId()] = sceneObject;
+	}
+
+	void ScenePicking::onSceneChanged()
+	{
+		mBVHFullSyncRequired = true;
+		mDirtyBVHObjects.clear();
+	}
+
 	Color ScenePicking::encodeIndex(UINT32 index)
 	{
 		Color encoded;
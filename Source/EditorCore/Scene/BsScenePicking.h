@@ -7,6 +7,7 @@
 #include "Math/BsMatrix4.h"
 #include "RenderAPI/BsGpuParam.h"
 #include "Renderer/BsParamBlocks.h"
+#include "Scene/BsSceneBVH.h"
 
 namespace bs
 {
@@ -31,6 +32,37 @@ namespace bs
 		float depth;
 	};
 
+	/** Determines how does ScenePicking find objects under the pointer. */
+	enum class ScenePickingBackend
+	{
+		/** 
+		 * Renders all pickable objects and gizmos into an index buffer on the GPU and reads it back. Picks objects
+		 * exactly as they are rendered, but stalls until the GPU finishes rendering. 
+		 */
+		GPU,
+		/**
+		 * Casts a ray through a bounding volume hierarchy of renderable objects on the CPU, and then against mesh 
+		 * triangles for meshes that keep a CPU copy of their data (bounds are used for other meshes). Doesn't require a
+		 * GPU, but gizmos cannot be picked.
+		 */
+		CPU
+	};
+
+	/** Determines how does ScenePicking find objects when picking an area larger than a single pixel. */
+	enum class AreaPickingMode
+	{
+		/** 
+		 * Returns all renderables and gizmos whose bounds intersect the sub-frustum defined by the picked area,
+		 * including occluded objects. Objects are sorted by distance from the camera.
+		 */
+		Bounds,
+		/** 
+		 * Uses the active picking backend, returning only visible objects. With the GPU backend objects are sorted by
+		 * the number of pixels they cover in the picked area.
+		 */
+		Precise
+	};
+
 	namespace ct { class ScenePicking; }
 
 	/**	Handles picking of scene objects with a pointer in scene view. */
@@ -47,6 +79,16 @@ namespace bs
 			HTexture mainTexture;
 		};
 
+		/** Contains information about a renderable object stored in the picking BVH. */
+		struct RenderableBVHData
+		{
+			HRenderable renderable;
+			HMesh mesh;
+			Matrix4 worldTransform;
+			UINT32 nodeIdx = SceneBVH::INVALID_NODE;
+			UINT64 syncIdx = 0;
+		};
+
 	public:
 		ScenePicking();
 		~ScenePicking();
@@ -84,9 +126,83 @@ namespace bs
 			const Vector2I& position, const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, 
 			SnapData* data = nullptr);
 
+		/** Changes the method used for finding objects under the pointer. */
+		void setBackend(ScenePickingBackend backend) { mBackend = backend; }
+
+		/** Returns the method used for finding objects under the pointer. */
+		ScenePickingBackend getBackend() const { return mBackend; }
+
+		/** 
+		 * Changes the method used for finding objects when picking an area larger than a single pixel. Defaults to
+		 * AreaPickingMode::Precise.
+		 */
+		void setAreaPickingMode(AreaPickingMode mode) { mAreaPickingMode = mode; }
+
+		/** Returns the method used for finding objects when picking an area larger than a single pixel. */
+		AreaPickingMode getAreaPickingMode() const { return mAreaPickingMode; }
+
 	private:
 		friend class ct::ScenePicking;
 
+		/** 
+		 * Finds the closest renderable object under the provided pointer position using the CPU backend. See pickObjects()
+		 * for parameter descriptions. Returned snap data is in world space.
+		 */
+		HSceneObject pickClosestObjectCPU(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area,
+			Vector<HSceneObject>& ignoreRenderables, SnapData* data);
+
+		/** 
+		 * Tests a ray against the triangles of a renderable in the picking BVH. If the renderable's mesh doesn't keep
+		 * a CPU copy of its data, the ray is tested against its bounds instead.
+		 *
+		 * @param[in]	entry		Renderable to test.
+		 * @param[in]	ray			World space ray to test.
+		 * @param[out]	distance	World space distance along the ray to the intersection, if one was found.
+		 * @param[out]	normal		World space normal of the surface at the intersection, if one was found.
+		 * @return					True if an intersection was found.
+		 */
+		bool intersectsRenderable(const RenderableBVHData& entry, const Ray& ray, float& distance, Vector3& normal) const;
+
+		/** 
+		 * Finds all renderables and gizmos whose bounds intersect the sub-frustum defined by the provided area. See 
+		 * pickObjects() for parameter descriptions.
+		 */
+		Vector<HSceneObject> pickObjectsInArea(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area,
+			Vector<HSceneObject>& ignoreRenderables);
+
+		/** 
+		 * Builds a world space convex volume that covers the provided area of the camera's viewport.
+		 *
+		 * @param[in]	cam			Camera whose view to build the volume for.
+		 * @param[in]	position	Top left corner of the area, in pixels relative to the camera viewport.
+		 * @param[in]	area		Width/height of the area, in pixels.
+		 * @return					Planes bounding the volume, with normals pointing inwards.
+		 */
+		static Vector<SceneBVH::ClipPlane> createAreaVolume(const SPtr<Camera>& cam, const Vector2I& position, 
+			const Vector2I& area);
+
+		/** 
+		 * Brings the picking BVH up to date with the modifications reported through SceneChangeNotifier since the last
+		 * update. Scene-wide modifications cause all renderables in the scene to be re-synced, while modifications of 
+		 * specific objects only re-sync the renderables in their hierarchies.
+		 */
+		void updateBVH();
+
+		/** 
+		 * Inserts the renderable into the picking BVH, or refits it if its transform or mesh changed since it was last
+		 * synced. Renderables without a loaded mesh are removed from the BVH.
+		 */
+		void syncBVHRenderable(const HRenderable& renderable);
+
+		/** Removes the renderable stored in the provided slot from the picking BVH. */
+		void removeBVHRenderable(UINT32 slot);
+
+		/** Triggered by SceneChangeNotifier when a specific scene object was modified. */
+		void onObjectChanged(const HSceneObject& sceneObject);
+
+		/** Triggered by SceneChangeNotifier when any part of the scene might have been modified. */
+		void onSceneChanged();
+
 		typedef Set<RenderablePickData, std::function<bool(const RenderablePickData&, const RenderablePickData&)>> RenderableSet;
 
 		/**	Encodes a pickable object identifier to a unique color. */
@@ -96,6 +212,19 @@ namespace bs
 		static UINT32 decodeIndex(Color color);
 
 		ct::ScenePicking* mCore;
+
+		ScenePickingBackend mBackend = ScenePickingBackend::GPU;
+		AreaPickingMode mAreaPickingMode = AreaPickingMode::Precise;
+		SceneBVH mBVH;
+		Vector<RenderableBVHData> mBVHRenderables;
+		Vector<UINT32> mFreeBVHSlots;
+		UnorderedMap<UINT64, UINT32> mBVHLookup;
+		UINT64 mBVHSyncIdx = 0;
+		bool mBVHFullSyncRequired = true;
+		UnorderedMap<UINT64, HSceneObject> mDirtyBVHObjects;
+
+		HEvent mObjectChangedConn;
+		HEvent mSceneChangedConn;
 	};
 
 	/** @} */
@@ -6,6 +6,7 @@
 #include "Library/BsProjectLibrary.h"
 #include "Library/BsProjectResourceMeta.h"
 #include "Utility/BsMessageHandler.h"
+#include "Scene/BsSceneObject.h"
 
 namespace bs
 {
@@ -29,6 +30,24 @@ namespace bs
 		}
 	}
 
+	/** Version of setDifference() for scene objects, using a lookup set so large selections don't take quadratic time. */
+	void setDifference(const Vector<HSceneObject>& a, const Vector<HSceneObject>& b, Vector<HSceneObject>& output)
+	{
+		UnorderedSet<UINT64> bIds;
+		for(auto& bEntry : b)
+		{
+			if(!bEntry.isDestroyed())
+				bIds.insert(bEntry->getInstanceId());
+		}
+
+		for(auto& aEntry : a)
+		{
+			// Destroyed entries are output as-is, the caller prunes them
+			if(aEntry.isDestroyed() || bIds.find(aEntry->getInstanceId()) == bIds.end())
+				output.push_back(aEntry);
+		}
+	}
+
 	Selection::Selection()
 	{
 		mSceneSelectionChangedConn = MessageHandler::instance().listen(
@@ -28,33 +28,152 @@ namespace bs
 		HMaterial selectionMat = BuiltinEditorResources::instance().createSelectionMat();
 			
 		mRenderer = RendererExtension::create<ct::SelectionRendererCore>(selectionMat->getCore());
+
+		mSceneObjectsAddedConn = Selection::instance().onSceneObjectsAdded.connect(
+			std::bind(&SelectionRenderer::onSceneObjectsAdded, this, _1));
+		mSceneObjectsRemovedConn = Selection::instance().onSceneObjectsRemoved.connect(
+			std::bind(&SelectionRenderer::onSceneObjectsRemoved, this, _1));
+
+		rebuild();
 	}
 
 	SelectionRenderer::~SelectionRenderer()
-	{ }
+	{
+		mSceneObjectsAddedConn.disconnect();
+		mSceneObjectsRemovedConn.disconnect();
+	}
 
 	void SelectionRenderer::update(const SPtr<Camera>& camera)
 	{
+		// Objects destroyed while selected are pruned from the selection without a notification
+		const Vector<HSceneObject>& sceneObjects = Selection::instance().getSceneObjects();
+		if (sceneObjects.size() != mSelectedObjects.size())
+			rebuild();
+
+		// Renderables can be destroyed, or have their mesh changed, independently of the selection
+		for (auto& entry : mRenderables)
+		{
+			SelectedRenderable& data = entry.second;
+
+			bool visible = !data.renderable.isDestroyed() && data.renderable->getMesh().isLoaded();
+			if (visible != data.visible)
+			{
+				data.visible = visible;
+				mRenderablesDirty = true;
+			}
+		}
+
 		Vector<SPtr<ct::Renderable>> objects;
+		bool updateObjects = mRenderablesDirty;
 
-		const Vector<HSceneObject>& sceneObjects = Selection::instance().getSceneObjects();
-		Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
+		if (mRenderablesDirty)
+		{
+			objects.reserve(mRenderables.size());
+			for (auto& entry : mRenderables)
+			{
+				if (entry.second.visible)
+					objects.push_back(entry.second.renderable->_getInternal()->getCore());
+			}
 
-		for (auto& renderable : renderables)
+			mRenderablesDirty = false;
+		}
+
+		ct::SelectionRendererCore* renderer = mRenderer.get();
+		gCoreThread().queueCommand(std::bind(&ct::SelectionRendererCore::updateData, renderer, camera->getCore(), 
+			objects, updateObjects));
+	}
+
+	void SelectionRenderer::onSceneObjectsAdded(const Vector<HSceneObject>& sceneObjects)
+	{
+		for (auto& so : sceneObjects)
+			addSceneObject(so);
+	}
+
+	void SelectionRenderer::onSceneObjectsRemoved(const Vector<HSceneObject>& sceneObjects)
+	{
+		for (auto& so : sceneObjects)
 		{
-			HSceneObject renderableSO = renderable->SO();
-			for (auto& so : sceneObjects)
+			if (!so.isDestroyed())
+				removeSceneObject(so->getInstanceId());
+		}
+	}
+
+	void SelectionRenderer::addSceneObject(const HSceneObject& sceneObject)
+	{
+		if (sceneObject.isDestroyed())
+			return;
+
+		UINT64 sceneObjectId = sceneObject->getInstanceId();
+		if (mSelectedObjects.find(sceneObjectId) != mSelectedObjects.end())
+			return;
+
+		Vector<UINT64>& contributed = mSelectedObjects[sceneObjectId];
+
+		Vector<HSceneObject> todo = { sceneObject };
+		while (!todo.empty())
+		{
+			HSceneObject so = todo.back();
+			todo.pop_back();
+
+			for (auto& component : so->getComponents())
 			{
-				if (renderableSO != so)
+				if (!rtti_is_of_type<CRenderable>(component.get()))
 					continue;
 
-				if (renderable->getMesh().isLoaded())
-					objects.push_back(renderable->_getInternal()->getCore());
+				HRenderable renderable = static_object_cast<CRenderable>(component);
+				UINT64 renderableId = renderable->getInstanceId();
+
+				SelectedRenderable& data = mRenderables[renderableId];
+				if (data.refCount == 0)
+				{
+					data.renderable = renderable;
+					data.visible = false; // Determined on the next update
+				}
+
+				data.refCount++;
+				contributed.push_back(renderableId);
 			}
+
+			UINT32 numChildren = so->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push_back(so->getChild(i));
 		}
+	}
 
-		ct::SelectionRendererCore* renderer = mRenderer.get();
-		gCoreThread().queueCommand(std::bind(&ct::SelectionRendererCore::updateData, renderer, camera->getCore(), objects));
+	void SelectionRenderer::removeSceneObject(UINT64 sceneObjectId)
+	{
+		auto iterFind = mSelectedObjects.find(sceneObjectId);
+		if (iterFind == mSelectedObjects.end())
+			return;
+
+		for (auto& renderableId : iterFind->second)
+		{
+			auto iterFindRenderable = mRenderables.find(renderableId);
+			if (iterFindRenderable == mRenderables.end())
+				continue;
+
+			SelectedRenderable& data = iterFindRenderable->second;
+			data.refCount--;
+
+			if (data.refCount == 0)
+			{
+				if (data.visible)
+					mRenderablesDirty = true;
+
+				mRenderables.erase(iterFindRenderable);
+			}
+		}
+
+		mSelectedObjects.erase(iterFind);
+	}
+
+	void SelectionRenderer::rebuild()
+	{
+		mSelectedObjects.clear();
+		mRenderables.clear();
+
+		onSceneObjectsAdded(Selection::instance().getSceneObjects());
+		mRenderablesDirty = true;
 	}
 
 	namespace ct
@@ -121,10 +240,24 @@ namespace bs
 		}
 	}
 
-	void SelectionRendererCore::updateData(const SPtr<Camera>& camera, const Vector<SPtr<Renderable>>& objects)
+	void SelectionRendererCore::updateData(const SPtr<Camera>& camera, const Vector<SPtr<Renderable>>& objects, 
+		bool updateObjects)
 	{
 		mCamera = camera;
+
+		if (!updateObjects)
+			return;
+
+		// Group by technique and mesh so render() can skip redundant pipeline changes
 		mObjects = objects;
+		std::sort(mObjects.begin(), mObjects.end(), 
+			[](const SPtr<Renderable>& a, const SPtr<Renderable>& b)
+		{
+			if (a->getAnimType() != b->getAnimType())
+				return a->getAnimType() < b->getAnimType();
+
+			return a->getMesh().get() < b->getMesh().get();
+		});
 	}
 
 	bool SelectionRendererCore::check(const Camera& camera)
@@ -140,6 +273,7 @@ namespace bs
 
 		SPtr<Renderer> renderer = gRenderer();
 
+		UINT32 boundAnimType = (UINT32)-1;
 		for (auto& renderable : mObjects)
 		{
 			SPtr<Mesh> mesh = renderable->getMesh();
@@ -151,14 +285,20 @@ namespace bs
 			SPtr<VertexDeclaration> morphVertexDeclaration = renderable->getMorphVertexDeclaration();
 
 			Matrix4 worldViewProjMat = viewProjMat * renderable->getMatrix();
-			UINT32 techniqueIdx = mTechniqueIndices[(int)renderable->getAnimType()];
+			UINT32 animType = (UINT32)renderable->getAnimType();
 
-			mMatWorldViewProj[techniqueIdx].set(worldViewProjMat);
-			mColor[techniqueIdx].set(SELECTION_COLOR);
-			mBoneMatrices[techniqueIdx].set(boneMatrixBuffer);
+			mMatWorldViewProj[animType].set(worldViewProjMat);
+			mColor[animType].set(SELECTION_COLOR);
+			mBoneMatrices[animType].set(boneMatrixBuffer);
+
+			// Objects are sorted by animation type, so the pipeline only changes a handful of times
+			if (animType != boundAnimType)
+			{
+				gRendererUtility().setPass(mMaterial, 0, mTechniqueIndices[animType]);
+				boundAnimType = animType;
+			}
 
-			gRendererUtility().setPass(mMaterial, 0, techniqueIdx);
-			gRendererUtility().setPassParams(mParams[techniqueIdx], 0);
+			gRendererUtility().setPassParams(mParams[animType], 0);
 
 			UINT32 numSubmeshes = mesh->getProperties().getNumSubMeshes();
 
@@ -16,7 +16,13 @@ namespace bs
 
 	namespace ct { class SelectionRendererCore; }
 
-	/**	Handles rendering of the selected SceneObject%s overlay. */
+	/**
+	 * Handles rendering of the selected SceneObject%s overlay. The overlay is drawn over all renderables of the selected
+	 * objects and their children. The set of renderables is maintained incrementally as objects are added to or removed
+	 * from the selection, so the cost doesn't depend on the number of renderables in the scene.
+	 *
+	 * @note	Children added to a selected object after it was selected are picked up on the next selection change.
+	 */
 	class BS_ED_EXPORT SelectionRenderer
 	{
 	public:
@@ -29,7 +35,37 @@ namespace bs
 	private:
 		friend class ct::SelectionRendererCore;
 
+		/** Renderable contributed to the overlay by one or multiple selected objects. */
+		struct SelectedRenderable
+		{
+			HRenderable renderable;
+			UINT32 refCount = 0;
+			bool visible = false;
+		};
+
+		/** Registers renderables of the newly selected objects and their children. */
+		void onSceneObjectsAdded(const Vector<HSceneObject>& sceneObjects);
+
+		/** Unregisters renderables contributed by objects that are no longer selected. */
+		void onSceneObjectsRemoved(const Vector<HSceneObject>& sceneObjects);
+
+		/** Registers a selected object and all renderables in its hierarchy. */
+		void addSceneObject(const HSceneObject& sceneObject);
+
+		/** Unregisters a selected object, releasing the renderables it contributed. */
+		void removeSceneObject(UINT64 sceneObjectId);
+
+		/** Rebuilds the tracked renderables from scratch, from the current selection. */
+		void rebuild();
+
 		SPtr<ct::SelectionRendererCore> mRenderer;
+
+		UnorderedMap<UINT64, Vector<UINT64>> mSelectedObjects; // Selected object ID -> IDs of contributed renderables
+		UnorderedMap<UINT64, SelectedRenderable> mRenderables;
+		bool mRenderablesDirty = true;
+
+		HEvent mSceneObjectsAddedConn;
+		HEvent mSceneObjectsRemovedConn;
 	};
 
 	namespace ct
@@ -55,10 +91,12 @@ namespace bs
 		/**
 		 * Updates the internal data that determines what will be rendered on the next render() call.
 		 *
-		 * @param[in]	camera		Camera to render the selection overlay in.
-		 * @param[in]	objects		A set of objects to render with the selection overlay.
+		 * @param[in]	camera			Camera to render the selection overlay in.
+		 * @param[in]	objects			A set of objects to render with the selection overlay. Ignored if 
+		 *								@p updateObjects is false.
+		 * @param[in]	updateObjects	If false the objects provided by the previous call are kept.
 		 */
-		void updateData(const SPtr<Camera>& camera, const Vector<SPtr<Renderable>>& objects);
+		void updateData(const SPtr<Camera>& camera, const Vector<SPtr<Renderable>>& objects, bool updateObjects);
 
 		Vector<SPtr<Renderable>> mObjects;
 		SPtr<Camera> mCamera;
@@ -4,9 +4,239 @@
 #include "Scene/BsSceneObject.h"
 #include "Serialization/BsMemorySerializer.h"
 #include "Utility/BsUtility.h"
+#include "Utility/BsCompression.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Utility/BsUUID.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
+	/** Temporary file holding compressed chunks moved out of memory. Deleted once no chunk references it. */
+	struct ChunkSpillFile
+	{
+		~ChunkSpillFile()
+		{
+			FileSystem::remove(path);
+		}
+
+		Path path;
+	};
+
+	/** 
+	 * Piece of a serialized scene object. Chunks with equal contents are shared between snapshots. A chunk is
+	 * compressed once all the snapshots referencing it are cold, and decompressed as soon as any of them is needed
+	 * again, so compression doesn't break the sharing.
+	 */
+	struct SerializedSceneObject::Chunk
+	{
+		~Chunk()
+		{
+			bs_free(data);
+			bs_free(compressedData);
+		}
+
+		/** Makes sure the uncompressed contents are in memory. Must be called with the mutex locked. */
+		void load()
+		{
+			if (data != nullptr)
+				return;
+
+			if (compressedData == nullptr)
+			{
+				compressedData = (UINT8*)bs_alloc(compressedSize);
+
+				SPtr<DataStream> file = FileSystem::openFile(spillFile->path, true);
+				file->seek(spillOffset);
+				file->read(compressedData, compressedSize);
+				file->close();
+
+				spillFile = nullptr;
+			}
+
+			SPtr<DataStream> input = bs_shared_ptr_new<MemoryDataStream>(compressedData, compressedSize, false);
+			SPtr<DataStream> decompressed = Compression::decompress(input);
+
+			data = (UINT8*)bs_alloc(size);
+			decompressed->seek(0);
+			decompressed->read(data, size);
+
+			bs_free(compressedData);
+			compressedData = nullptr;
+		}
+
+		/** Replaces the uncompressed contents with compressed ones. Must be called with the mutex locked. */
+		void compress()
+		{
+			if (data == nullptr)
+				return;
+
+			SPtr<DataStream> input = bs_shared_ptr_new<MemoryDataStream>(data, size, false);
+			SPtr<DataStream> compressed = Compression::compress(input);
+
+			compressedSize = (UINT32)compressed->size();
+			compressedData = (UINT8*)bs_alloc(compressedSize);
+			compressed->seek(0);
+			compressed->read(compressedData, compressedSize);
+
+			bs_free(data);
+			data = nullptr;
+		}
+
+		/** Returns the number of bytes the chunk currently occupies in memory. Must be called with the mutex locked. */
+		UINT32 getMemoryUsage() const
+		{
+			if (data != nullptr)
+				return size;
+
+			return compressedData != nullptr ? compressedSize : 0;
+		}
+
+		UINT8* data = nullptr;
+		UINT32 size = 0;
+
+		UINT8* compressedData = nullptr;
+		UINT32 compressedSize = 0;
+
+		SPtr<ChunkSpillFile> spillFile;
+		UINT32 spillOffset = 0;
+
+		/** Number of snapshots referencing the chunk that aren't cold. */
+		UINT32 numHotRefs = 0;
+		Mutex mutex;
+	};
+
+	/** Chunks smaller than this won't be split further, unless at the end of the data. */
+	static constexpr UINT32 MIN_CHUNK_SIZE = 256;
+
+	/** Chunks larger than this are always split. */
+	static constexpr UINT32 MAX_CHUNK_SIZE = 8192;
+
+	/** Chunk boundary is placed where the rolling hash has these bits cleared, resulting in ~1KB chunks on average. */
+	static constexpr UINT64 CHUNK_BOUNDARY_MASK = 0x3FF;
+
+	/** Random values used by the rolling hash, one for each byte value. */
+	struct GearTable
+	{
+		GearTable()
+		{
+			// Split-mix generator, so the values are equal between runs and platforms
+			UINT64 state = 0x9E3779B97F4A7C15ULL;
+			for (UINT32 i = 0; i < 256; i++)
+			{
+				state += 0x9E3779B97F4A7C15ULL;
+
+				UINT64 value = state;
+				value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+				values[i] = value ^ (value >> 31);
+			}
+		}
+
+		UINT64 values[256];
+	};
+
+	/** Returns the rolling hash lookup table. */
+	static const GearTable& getGearTable()
+	{
+		static GearTable table;
+		return table;
+	}
+
+	/** 
+	 * Keeps track of all live chunks by their content hash, so that snapshots of the same object share the parts that 
+	 * didn't change between them. Chunks are owned by the snapshots and are released along with the last snapshot 
+	 * referencing them.
+	 */
+	class SnapshotChunkStore
+	{
+	public:
+		/** Returns a chunk with the provided contents, either an existing one or a newly created one. */
+		SPtr<SerializedSceneObject::Chunk> acquire(const UINT8* data, UINT32 size)
+		{
+			UINT64 hash = 14695981039346656037ULL;
+			for (UINT32 i = 0; i < size; i++)
+			{
+				hash ^= data[i];
+				hash *= 1099511628211ULL;
+			}
+
+			Lock lock(mMutex);
+
+			auto iterFind = mChunks.find(hash);
+			if (iterFind != mChunks.end())
+			{
+				SPtr<SerializedSceneObject::Chunk> existing = iterFind->second.lock();
+				if (existing != nullptr && existing->size == size)
+				{
+					Lock chunkLock(existing->mutex);
+
+					// Chunk might be compressed if all the snapshots referencing it are cold
+					existing->load();
+					if (memcmp(existing->data, data, size) == 0)
+					{
+						existing->numHotRefs++;
+						return existing;
+					}
+				}
+			}
+
+			SPtr<SerializedSceneObject::Chunk> chunk = bs_shared_ptr_new<SerializedSceneObject::Chunk>();
+			chunk->data = (UINT8*)bs_alloc(size);
+			chunk->size = size;
+			chunk->numHotRefs = 1;
+			memcpy(chunk->data, data, size);
+
+			// On a hash collision the new chunk simply replaces the old one in the lookup, and neither is shared further
+			mChunks[hash] = chunk;
+
+			if (mChunks.size() >= mNextPruneSize)
+			{
+				for (auto iter = mChunks.begin(); iter != mChunks.end();)
+				{
+					if (iter->second.expired())
+						iter = mChunks.erase(iter);
+					else
+						++iter;
+				}
+
+				mNextPruneSize = std::max((UINT32)mChunks.size() * 2, 1024U);
+			}
+
+			return chunk;
+		}
+
+		/** 
+		 * Returns the chunks from the provided list that aren't referenced by any other snapshot. Checked while no new
+		 * references can be acquired through the store.
+		 */
+		Vector<SPtr<SerializedSceneObject::Chunk>> findUnshared(const Vector<SPtr<SerializedSceneObject::Chunk>>& chunks)
+		{
+			Vector<SPtr<SerializedSceneObject::Chunk>> output;
+
+			Lock lock(mMutex);
+			for (auto& chunk : chunks)
+			{
+				if (chunk.use_count() == 1)
+					output.push_back(chunk);
+			}
+
+			return output;
+		}
+
+	private:
+		UnorderedMap<UINT64, std::weak_ptr<SerializedSceneObject::Chunk>> mChunks;
+		UINT32 mNextPruneSize = 1024;
+		Mutex mMutex;
+	};
+
+	/** Returns the store shared by all snapshots. Never destroyed, as snapshots might outlive static destruction. */
+	static SnapshotChunkStore& getChunkStore()
+	{
+		static SnapshotChunkStore* store = new SnapshotChunkStore();
+		return *store;
+	}
+
 	SerializedSceneObject::SerializedSceneObject(const HSceneObject& sceneObject, bool hierarchy)
 		:mSceneObject(sceneObject), mRecordHierarchy(hierarchy)
 	{
@@ -16,6 +246,8 @@ namespace bs
 		UINT32 numChildren = mSceneObject->getNumChildren();
 		HSceneObject* children = nullptr;
 
+		// Children are detached without preserving their world transform, so that re-attaching them later restores them 
+		// exactly, and no transforms need to be recalculated
 		if (!mRecordHierarchy)
 		{
 			children = bs_stack_new<HSceneObject>(numChildren);
@@ -24,7 +256,7 @@ namespace bs
 				HSceneObject child = mSceneObject->getChild(i);
 				children[i] = child;
 
-				child->setParent(HSceneObject());
+				child->setParent(HSceneObject(), false);
 			}
 		}
 
@@ -32,11 +264,14 @@ namespace bs
 		mSceneObject->_setFlags(SOF_DontInstantiate);
 
 		MemorySerializer serializer;
-		mSerializedObject = serializer.encode(mSceneObject.get(), mSerializedObjectSize);
+		UINT8* serializedObject = serializer.encode(mSceneObject.get(), mSerializedObjectSize);
 
 		if (isInstantiated)
 			mSceneObject->_unsetFlags(SOF_DontInstantiate);
 
+		setSerializedData(serializedObject, mSerializedObjectSize);
+		bs_free(serializedObject);
+
 		mSceneObjectProxy = EditorUtility::createProxy(mSceneObject);
 
 		HSceneObject parent = sceneObject->getParent();
@@ -46,7 +281,7 @@ namespace bs
 		if (!mRecordHierarchy)
 		{
 			for (UINT32 i = 0; i < numChildren; i++)
-				children[i]->setParent(sceneObject->getHandle());
+				children[i]->setParent(sceneObject->getHandle(), false);
 
 			bs_stack_delete(children, numChildren);
 		}
@@ -54,15 +289,177 @@ namespace bs
 
 	SerializedSceneObject::~SerializedSceneObject()
 	{
-		if (mSerializedObject != nullptr)
+		if (mCompressTask != nullptr)
+			mCompressTask->wait();
+
+		if (!mIsCold)
+		{
+			for (auto& chunk : mChunks)
+			{
+				Lock lock(chunk->mutex);
+				chunk->numHotRefs--;
+			}
+		}
+	}
+
+	UINT64 SerializedSceneObject::getMemoryUsage() const
+	{
+		UINT64 usage = sizeof(SerializedSceneObject) + mChunks.size() * sizeof(SPtr<Chunk>);
+
+		// Chunks shared between multiple snapshots are split evenly between them
+		for (auto& chunk : mChunks)
+		{
+			Lock lock(chunk->mutex);
+			usage += chunk->getMemoryUsage() / std::max((UINT64)chunk.use_count(), (UINT64)1);
+		}
+
+		return usage;
+	}
+
+	void SerializedSceneObject::compress(bool spillToDisk)
+	{
+		if (mIsCold || mChunks.empty())
+			return;
+
+		mIsCold = true;
+
+		// Chunk list isn't modified until the task completes, only the chunks themselves, which are locked
+		auto compressAsync = [this, spillToDisk]()
+		{
+			for (auto& chunk : mChunks)
+			{
+				Lock lock(chunk->mutex);
+
+				// Chunks still referenced by snapshots that are in use are left as is
+				chunk->numHotRefs--;
+				if (chunk->numHotRefs == 0)
+					chunk->compress();
+			}
+
+			if (!spillToDisk)
+				return;
+
+			// Only chunks referenced by this snapshot alone are moved to disk, shared ones stay in memory compressed
+			Vector<SPtr<Chunk>> unsharedChunks = getChunkStore().findUnshared(mChunks);
+			if (unsharedChunks.empty())
+				return;
+
+			SPtr<ChunkSpillFile> spillFile = bs_shared_ptr_new<ChunkSpillFile>();
+			spillFile->path = Path::combine(FileSystem::getTempDirectoryPath(),
+				"undo_" + UUIDGenerator::generateRandom().toString() + ".bin");
+
+			SPtr<DataStream> file = FileSystem::createAndOpenFile(spillFile->path);
+
+			// Chunks keep their in-memory copy until the file is complete, as they can be acquired and loaded by
+			// another snapshot at any point
+			Vector<std::pair<SPtr<Chunk>, UINT32>> writtenChunks;
+			UINT32 offset = 0;
+			for (auto& chunk : unsharedChunks)
+			{
+				Lock lock(chunk->mutex);
+				if (chunk->compressedData == nullptr)
+					continue;
+
+				file->write(chunk->compressedData, chunk->compressedSize);
+				writtenChunks.push_back(std::make_pair(chunk, offset));
+
+				offset += chunk->compressedSize;
+			}
+
+			file->close();
+
+			for (auto& entry : writtenChunks)
+			{
+				const SPtr<Chunk>& chunk = entry.first;
+
+				// Skip chunks that were loaded in the meantime, the spilled copy is no longer needed
+				Lock lock(chunk->mutex);
+				if (chunk->compressedData == nullptr || chunk->data != nullptr)
+					continue;
+
+				bs_free(chunk->compressedData);
+				chunk->compressedData = nullptr;
+				chunk->spillFile = spillFile;
+				chunk->spillOffset = entry.second;
+			}
+		};
+
+		mCompressTask = Task::create("CompressSceneObject", compressAsync, TaskPriority::Low);
+		TaskScheduler::instance().addTask(mCompressTask);
+	}
+
+	void SerializedSceneObject::decompress()
+	{
+		if (mCompressTask != nullptr)
+		{
+			mCompressTask->wait();
+			mCompressTask = nullptr;
+		}
+
+		if (!mIsCold)
+			return;
+
+		for (auto& chunk : mChunks)
+		{
+			Lock lock(chunk->mutex);
+
+			chunk->load();
+			chunk->numHotRefs++;
+		}
+
+		mIsCold = false;
+	}
+
+	void SerializedSceneObject::setSerializedData(const UINT8* data, UINT32 size)
+	{
+		const GearTable& gear = getGearTable();
+		SnapshotChunkStore& store = getChunkStore();
+
+		mChunks.clear();
+		mSerializedObjectSize = size;
+
+		// Split the data at content defined boundaries, so an edit only affects the chunks it touches, and the chunks
+		// after it realign with the ones from the previous snapshot
+		UINT32 start = 0;
+		while (start < size)
 		{
-			bs_free(mSerializedObject);
-			mSerializedObject = nullptr;
+			UINT32 end = std::min(start + MAX_CHUNK_SIZE, size);
+			UINT32 cut = end;
+
+			UINT64 hash = 0;
+			for (UINT32 i = start + MIN_CHUNK_SIZE; i < end; i++)
+			{
+				hash = (hash << 1) + gear.values[data[i]];
+				if ((hash & CHUNK_BOUNDARY_MASK) == 0)
+				{
+					cut = i + 1;
+					break;
+				}
+			}
+
+			mChunks.push_back(store.acquire(data + start, cut - start));
+			start = cut;
 		}
 	}
 
+	UINT8* SerializedSceneObject::getSerializedData() const
+	{
+		UINT8* data = (UINT8*)bs_alloc(mSerializedObjectSize);
+
+		UINT32 offset = 0;
+		for (auto& chunk : mChunks)
+		{
+			memcpy(data + offset, chunk->data, chunk->size);
+			offset += chunk->size;
+		}
+
+		return data;
+	}
+
 	void SerializedSceneObject::restore()
 	{
+		decompress();
+
 		HSceneObject parent;
 		if (mSerializedObjectParentId != 0)
 			parent = static_object_cast<SceneObject>(GameObjectManager::instance().getObject(mSerializedObjectParentId));
@@ -80,7 +477,7 @@ namespace bs
 					HSceneObject child = mSceneObject->getChild(i);
 					children[i] = child;
 
-					child->setParent(HSceneObject());
+					child->setParent(HSceneObject(), false);
 				}
 			}
 
@@ -90,9 +487,13 @@ namespace bs
 		CoreSerializationContext serzContext;
 		serzContext.goState = bs_shared_ptr_new<GameObjectDeserializationState>(GODM_RestoreExternal | GODM_UseNewIds);
 
+		UINT8* serializedObject = getSerializedData();
+
 		MemorySerializer serializer;
 		SPtr<SceneObject> restored = std::static_pointer_cast<SceneObject>(
-			serializer.decode(mSerializedObject, mSerializedObjectSize, &serzContext));
+			serializer.decode(serializedObject, mSerializedObjectSize, &serzContext));
+
+		bs_free(serializedObject);
 
 		EditorUtility::restoreIds(restored->getHandle(), mSceneObjectProxy);
 		restored->setParent(parent);
@@ -100,11 +501,11 @@ namespace bs
 		if (children)
 		{
 			for (UINT32 i = 0; i < numChildren; i++)
-				children[i]->setParent(restored->getHandle());
+				children[i]->setParent(restored->getHandle(), false);
 
 			bs_stack_delete(children, numChildren);
 		}
 
 		restored->_instantiate();
 	}
-}
+}
\ No newline at end of file
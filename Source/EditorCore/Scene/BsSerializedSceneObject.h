@@ -15,6 +15,10 @@ namespace bs
 	 * Serializes the current state of a scene object and allows that state to be restored. The advantage of using this 
 	 * class versus normal serialization is that the deserialization happens into the original scene object, instead of
 	 * creating a new scene object.
+	 *
+	 * The serialized state is split into content defined chunks, which are shared with all other snapshots that contain
+	 * the same data. Taking repeated snapshots of an object therefore only uses additional memory for the parts of the
+	 * object that changed.
 	 */
 	class BS_ED_EXPORT BS_SCRIPT_EXPORT(m:Utility-Editor,api:bed) SerializedSceneObject final
 	{
@@ -37,16 +41,55 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		void restore();
 
+		/** Returns the scene object whose state was serialized. */
+		const HSceneObject& getSceneObject() const { return mSceneObject; }
+
+		/** Returns the amount of memory used by the serialized state, in bytes. Data moved to disk is not counted. */
+		BS_SCRIPT_EXPORT()
+		UINT64 getMemoryUsage() const;
+
+		/**
+		 * Compresses the serialized state on a worker thread, reducing its memory footprint. The state is decompressed on
+		 * demand when restore() is called. Does nothing if the state is already compressed.
+		 *
+		 * Each chunk is compressed separately and stays shared with other snapshots. Chunks still referenced by snapshots
+		 * that aren't compressed remain uncompressed.
+		 *
+		 * @param[in]	spillToDisk		If true the compressed chunks not shared with any other snapshot will be
+		 *								written to a temporary file and released from memory.
+		 */
+		BS_SCRIPT_EXPORT()
+		void compress(bool spillToDisk = false);
+
 	private:
 		friend class UndoRedo;
+		friend class SnapshotChunkStore;
+
+		/** Piece of the serialized state, shared between snapshots with equal contents. */
+		struct Chunk;
+
+		/** Waits until any pending compression finishes and decompresses the chunks, if needed. */
+		void decompress();
+
+		/** Splits the provided serialized state into chunks and stores them. */
+		void setSerializedData(const UINT8* data, UINT32 size);
+
+		/** 
+		 * Assembles the serialized state from the stored chunks. Caller is responsible for freeing the returned buffer
+		 * with bs_free().
+		 */
+		UINT8* getSerializedData() const;
 
 		HSceneObject mSceneObject;
 		EditorUtility::SceneObjProxy mSceneObjectProxy;
 		bool mRecordHierarchy;
 
-		UINT8* mSerializedObject = nullptr;
+		Vector<SPtr<Chunk>> mChunks;
 		UINT32 mSerializedObjectSize = 0;
 		UINT64 mSerializedObjectParentId = 0;
+
+		SPtr<Task> mCompressTask;
+		bool mIsCold = false;
 	};
 
 	/** @} */
@@ -62,6 +62,15 @@ namespace bs
 		/** Retrieves the maximum number of frames per second the editor is allowed to execute. Zero means infinite. */
 		UINT32 getFPSLimit() const { return mFPSLimit; }
 
+		/** 
+		 * Checks is idle mode enabled. In idle mode editor windows that don't have focus and have no pending changes
+		 * skip their update, and the editor is throttled to the idle FPS limit when no window needs updating.
+		 */
+		bool getIdleModeEnabled() const { return mIdleModeEnabled; }
+
+		/** Retrieves the maximum number of frames per second the editor is allowed to execute while idle. */
+		UINT32 getIdleFPSLimit() const { return mIdleFPSLimit; }
+
 		/** 
 		 * Retrieves a value that controls sensitivity of mouse movements. This doesn't apply to mouse cursor. 
 		 * Default value is 1.0f.
@@ -110,6 +119,12 @@ namespace bs
 		/** Sets the maximum number of frames per second the editor is allowed to execute. Zero means infinite. */
 		void setFPSLimit(UINT32 limit) { mFPSLimit = limit; markAsDirty(); }
 
+		/** Enables or disables idle mode. See getIdleModeEnabled(). */
+		void setIdleModeEnabled(bool enabled) { mIdleModeEnabled = enabled; markAsDirty(); }
+
+		/** Sets the maximum number of frames per second the editor is allowed to execute while idle. */
+		void setIdleFPSLimit(UINT32 limit) { mIdleFPSLimit = limit; markAsDirty(); }
+
 		/** 
 		 * Sets a value that controls sensitivity of mouse movements. This doesn't apply to mouse cursor. 
 		 * Default value is 1.0f.
@@ -133,6 +148,8 @@ namespace bs
 		float mHandleSize = 0.10f;
 		UINT32 mFPSLimit = 60;
 		float mMouseSensitivity = 1.0f;
+		bool mIdleModeEnabled = false;
+		UINT32 mIdleFPSLimit = 10;
 
 		Path mLastOpenProject;
 		bool mAutoLoadLastProject = true;
@@ -0,0 +1,21 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Testing/BsEditorBenchmark.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	void EditorBenchmark::saveJSON(const Path& path) const
+	{
+		String json = toJSON();
+
+		Path folder = path.getParent();
+		if (!FileSystem::exists(folder))
+			FileSystem::createDir(folder);
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->write(json.c_str(), json.size() * sizeof(String::value_type));
+		stream->close();
+	}
+}
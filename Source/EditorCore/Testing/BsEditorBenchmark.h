@@ -0,0 +1,27 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Testing-Editor
+	 *  @{
+	 */
+
+	/** Base class for editor benchmarks whose results can be exported as JSON, for comparison between runs. */
+	class BS_ED_EXPORT EditorBenchmark
+	{
+	public:
+		virtual ~EditorBenchmark() = default;
+
+		/** Returns the results of the last run as a JSON string. */
+		virtual String toJSON() const = 0;
+
+		/** Writes the result of toJSON() to the specified file. Creates the parent folder if it doesn't exist. */
+		void saveJSON(const Path& path) const;
+	};
+
+	/** @} */
+}
@@ -15,6 +15,21 @@
 #include "FileSystem/BsFileSystem.h"
 #include "Scene/BsSceneManager.h"
 #include "Scene/BsSerializedSceneObject.h"
+#include "Scene/BsSceneBVH.h"
+#include "Math/BsRay.h"
+#include "Testing/BsSceneViewBenchmark.h"
+#include "Components/BsCCamera.h"
+#include "RenderAPI/BsViewport.h"
+#include "BsEditorApplication.h"
+#include "Utility/BsBidirectionalDiff.h"
+#include "Testing/BsUndoRedoBenchmark.h"
+#include "Testing/BsSceneSaveBenchmark.h"
+#include "Scene/BsScenePicking.h"
+#include "Scene/BsSceneChangeNotifier.h"
+#include "Scene/BsSceneBoundsCache.h"
+#include "Scene/BsGizmoManager.h"
+#include "Components/BsCRenderable.h"
+#include "Resources/BsBuiltinResources.h"
 
 namespace bs
 {
@@ -405,6 +420,36 @@ namespace bs
 		return TestComponentD::getRTTIStatic();
 	}
 
+	/** Command that does nothing except for reporting a fixed memory usage and counting how many times it was reverted. */
+	class TestMemoryCommand : public EditorCommand
+	{
+	public:
+		TestMemoryCommand(UINT64 memoryUsage, UINT32& numReverts)
+			:EditorCommand(""), mMemoryUsage(memoryUsage), mNumReverts(numReverts)
+		{ }
+
+		void revert() override { mNumReverts++; }
+		UINT64 getMemoryUsage() const override { return mMemoryUsage; }
+
+	private:
+		UINT64 mMemoryUsage;
+		UINT32& mNumReverts;
+	};
+
+	/** Command that counts how many times it was notified it became cold. */
+	class TestColdCommand : public EditorCommand
+	{
+	public:
+		TestColdCommand(UINT32& numCold)
+			:EditorCommand(""), mNumCold(numCold)
+		{ }
+
+	private:
+		void onCommandCold(bool spillToDisk) override { mNumCold++; }
+
+		UINT32& mNumCold;
+	};
+
 	EditorTestSuite::EditorTestSuite()
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
@@ -413,6 +458,20 @@ namespace bs
 		BS_ADD_TEST(EditorTestSuite::TestPrefabComplex);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc);
+		BS_ADD_TEST(EditorTestSuite::TestSceneBVH);
+		BS_ADD_TEST(EditorTestSuite::TestScenePickingCPU);
+		BS_ADD_TEST(EditorTestSuite::TestSceneBoundsCache);
+		BS_ADD_TEST(EditorTestSuite::TestSceneViewBenchmark);
+		BS_ADD_TEST(EditorTestSuite::UndoRedo_MemoryBudget);
+		BS_ADD_TEST(EditorTestSuite::SerializedSceneObject_Sharing);
+		BS_ADD_TEST(EditorTestSuite::SerializedSceneObject_Compress);
+		BS_ADD_TEST(EditorTestSuite::TestBidirectionalDiff);
+		BS_ADD_TEST(EditorTestSuite::SceneObjectDeleteMulti_UndoRedo);
+		BS_ADD_TEST(EditorTestSuite::TestUndoRedoBenchmark);
+		BS_ADD_TEST(EditorTestSuite::UndoRedo_CommandInfo);
+		BS_ADD_TEST(EditorTestSuite::UndoRedo_Arena);
+		BS_ADD_TEST(EditorTestSuite::UndoRedo_PopCommand);
+		BS_ADD_TEST(EditorTestSuite::TestSceneSaveBenchmark);
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -806,4 +865,657 @@ namespace bs
 		alloc.free(a13);
 		alloc.clear();
 	}
+
+	void EditorTestSuite::TestSceneBVH()
+	{
+		SceneBVH bvh;
+
+		UINT32 nodes[3];
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			Vector3 center(i * 10.0f, 0.0f, 0.0f);
+			nodes[i] = bvh.insert(AABox(center - Vector3::ONE, center + Vector3::ONE), i);
+		}
+
+		BS_TEST_ASSERT(bvh.getNumLeaves() == 3);
+
+		// Ray along the X axis should hit all boxes, sorted by distance
+		Vector<SceneBVH::RayHit> hits;
+		bvh.intersects(Ray(Vector3(-5.0f, 0.0f, 0.0f), Vector3::UNIT_X), hits);
+
+		BS_TEST_ASSERT(hits.size() == 3);
+		BS_TEST_ASSERT(hits[0].data == 0 && hits[1].data == 1 && hits[2].data == 2);
+
+		// Ray along the Y axis through the middle box should only hit it
+		bvh.intersects(Ray(Vector3(10.0f, -5.0f, 0.0f), Vector3::UNIT_Y), hits);
+
+		BS_TEST_ASSERT(hits.size() == 1);
+		BS_TEST_ASSERT(hits[0].data == 1);
+
+		// Small movements fit in the inflated bounds and shouldn't modify the tree
+		Vector3 offset(0.05f, 0.0f, 0.0f);
+		BS_TEST_ASSERT(!bvh.update(nodes[1], AABox(Vector3(10.0f, 0.0f, 0.0f) - Vector3::ONE + offset, 
+			Vector3(10.0f, 0.0f, 0.0f) + Vector3::ONE + offset)));
+
+		// Move the middle box out of the way
+		Vector3 newCenter(10.0f, 20.0f, 0.0f);
+		BS_TEST_ASSERT(bvh.update(nodes[1], AABox(newCenter - Vector3::ONE, newCenter + Vector3::ONE)));
+
+		bvh.intersects(Ray(Vector3(10.0f, -5.0f, 0.0f), Vector3::UNIT_Y), hits);
+		BS_TEST_ASSERT(hits.size() == 1);
+		BS_TEST_ASSERT(hits[0].data == 1 && hits[0].t > 20.0f);
+
+		bvh.intersects(Ray(Vector3(-5.0f, 0.0f, 0.0f), Vector3::UNIT_X), hits);
+		BS_TEST_ASSERT(hits.size() == 2);
+
+		// Remove the first box
+		bvh.remove(nodes[0]);
+		BS_TEST_ASSERT(bvh.getNumLeaves() == 2);
+
+		bvh.intersects(Ray(Vector3(-5.0f, 0.0f, 0.0f), Vector3::UNIT_X), hits);
+		BS_TEST_ASSERT(hits.size() == 1);
+		BS_TEST_ASSERT(hits[0].data == 2);
+
+		bvh.clear();
+		bvh.intersects(Ray(Vector3(-5.0f, 0.0f, 0.0f), Vector3::UNIT_X), hits);
+		BS_TEST_ASSERT(hits.empty());
+	}
+
+	void EditorTestSuite::TestScenePickingCPU()
+	{
+		ScenePicking& picking = ScenePicking::instance();
+		ScenePickingBackend oldBackend = picking.getBackend();
+		picking.setBackend(ScenePickingBackend::CPU);
+
+		HSceneObject cameraSO = SceneObject::create("PickingCamera");
+		cameraSO->setPosition(Vector3(0.0f, 0.0f, 10.0f));
+		cameraSO->lookAt(Vector3::ZERO);
+
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gCoreApplication().getPrimaryWindow());
+
+		HSceneObject boxSO = SceneObject::create("PickingBox");
+		HRenderable renderable = boxSO->addComponent<CRenderable>();
+		renderable->setMesh(BuiltinResources::instance().getMesh(BuiltinMesh::Box));
+		SceneChangeNotifier::instance().notifyObjectChanged(boxSO);
+
+		SPtr<Camera> cam = camera->_getCamera();
+		Rect2I viewArea = cam->getViewport()->getPixelArea();
+		Vector2I center(viewArea.width / 2, viewArea.height / 2);
+
+		GizmoDrawSettings drawSettings;
+		Vector<HSceneObject> ignored;
+
+		HSceneObject picked = picking.pickClosestObject(cam, drawSettings, center, Vector2I(1, 1), ignored);
+		BS_TEST_ASSERT(picked == boxSO);
+
+		// Ignored objects must not be returned
+		ignored.push_back(boxSO);
+		picked = picking.pickClosestObject(cam, drawSettings, center, Vector2I(1, 1), ignored);
+		BS_TEST_ASSERT(picked != boxSO);
+		ignored.clear();
+
+		// Moves reported for the object must be picked up without a scene-wide change
+		boxSO->setPosition(Vector3(100.0f, 0.0f, 0.0f));
+		SceneChangeNotifier::instance().notifyObjectChanged(boxSO);
+
+		picked = picking.pickClosestObject(cam, drawSettings, center, Vector2I(1, 1), ignored);
+		BS_TEST_ASSERT(picked != boxSO);
+
+		boxSO->setPosition(Vector3::ZERO);
+		SceneChangeNotifier::instance().notifyObjectChanged(boxSO);
+
+		picked = picking.pickClosestObject(cam, drawSettings, center, Vector2I(1, 1), ignored);
+		BS_TEST_ASSERT(picked == boxSO);
+
+		// Renderables destroyed before the change is reported must be skipped
+		boxSO->destroy(true);
+
+		picked = picking.pickClosestObject(cam, drawSettings, center, Vector2I(1, 1), ignored);
+		BS_TEST_ASSERT(picked != boxSO);
+
+		SceneChangeNotifier::instance().notifySceneChanged();
+		picked = picking.pickClosestObject(cam, drawSettings, center, Vector2I(1, 1), ignored);
+		BS_TEST_ASSERT(picked != boxSO);
+
+		cameraSO->destroy();
+		picking.setBackend(oldBackend);
+	}
+
+	void EditorTestSuite::TestSceneBoundsCache()
+	{
+		SceneBoundsCache cache;
+		SceneChangeNotifier& notifier = SceneChangeNotifier::instance();
+
+		HSceneObject parentSO = SceneObject::create("BoundsParent");
+		HSceneObject childSO = SceneObject::create("BoundsChild");
+		childSO->setParent(parentSO);
+
+		HMesh mesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+		HRenderable renderable = childSO->addComponent<CRenderable>();
+		renderable->setMesh(mesh);
+		notifier.notifySceneChanged();
+
+		AABox bounds;
+		BS_TEST_ASSERT(!cache.getBounds(parentSO, bounds));
+		BS_TEST_ASSERT(cache.getBounds(childSO, bounds));
+		BS_TEST_ASSERT(cache.getHierarchyBounds({ parentSO }, bounds));
+
+		Vector3 initialCenter = bounds.getCenter();
+
+		// Moving the child must update its bounds, and the aggregated bounds of its parent
+		childSO->setPosition(Vector3(10.0f, 0.0f, 0.0f));
+		notifier.notifyObjectChanged(childSO);
+
+		BS_TEST_ASSERT(cache.getHierarchyBounds({ parentSO }, bounds));
+		BS_TEST_ASSERT(Math::approxEquals(bounds.getCenter(), initialCenter + Vector3(10.0f, 0.0f, 0.0f), 0.01f));
+
+		// Moving the parent must update the bounds of its children
+		parentSO->setPosition(Vector3(0.0f, 5.0f, 0.0f));
+		notifier.notifyObjectChanged(parentSO);
+
+		BS_TEST_ASSERT(cache.getBounds(childSO, bounds));
+		BS_TEST_ASSERT(Math::approxEquals(bounds.getCenter(), initialCenter + Vector3(10.0f, 5.0f, 0.0f), 0.01f));
+
+		// Components added to the hierarchy are picked up after a scene-wide change
+		HRenderable parentRenderable = parentSO->addComponent<CRenderable>();
+		parentRenderable->setMesh(mesh);
+		notifier.notifySceneChanged();
+
+		BS_TEST_ASSERT(cache.getBounds(parentSO, bounds));
+		BS_TEST_ASSERT(cache.getHierarchyBounds({ parentSO }, bounds));
+		BS_TEST_ASSERT(bounds.contains(initialCenter + Vector3(0.0f, 5.0f, 0.0f)));
+		BS_TEST_ASSERT(bounds.contains(initialCenter + Vector3(10.0f, 5.0f, 0.0f)));
+
+		parentSO->destroy();
+
+		// Bounds of objects deep in a hierarchy are aggregated all the way to its root
+		HSceneObject chainRoot = SceneObject::create("BoundsChain");
+		HSceneObject chainLeaf = chainRoot;
+		for (UINT32 i = 0; i < 256; i++)
+		{
+			HSceneObject chainChild = SceneObject::create("BoundsChain");
+			chainChild->setParent(chainLeaf);
+			chainLeaf = chainChild;
+		}
+
+		chainLeaf->setPosition(Vector3(0.0f, 0.0f, 20.0f));
+		HRenderable leafRenderable = chainLeaf->addComponent<CRenderable>();
+		leafRenderable->setMesh(mesh);
+		notifier.notifySceneChanged();
+
+		BS_TEST_ASSERT(!cache.getBounds(chainRoot, bounds));
+		BS_TEST_ASSERT(cache.getHierarchyBounds({ chainRoot }, bounds));
+		BS_TEST_ASSERT(bounds.contains(chainLeaf->getTransform().getPosition()));
+
+		chainRoot->destroy();
+	}
+
+	void EditorTestSuite::TestSceneViewBenchmark()
+	{
+		HSceneObject cameraSO = SceneObject::create("BenchmarkCamera");
+		cameraSO->setPosition(Vector3(0.0f, 0.0f, 50.0f));
+		cameraSO->lookAt(Vector3::ZERO);
+
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gCoreApplication().getPrimaryWindow());
+
+		SceneViewBenchmarkDesc desc;
+		desc.numEmptyObjects = 4;
+		desc.numRenderables = 16;
+		desc.numLights = 4;
+		desc.numGizmos = 8;
+		desc.numSelected = 4;
+		desc.numFrames = 3;
+
+		{
+			UINT32 numScriptGizmoCalls = 0;
+
+			SceneViewBenchmark benchmark(desc);
+			benchmark.setScriptGizmoCallback([&]() { numScriptGizmoCalls++; });
+			benchmark.run(camera->_getCamera());
+
+			BS_TEST_ASSERT(numScriptGizmoCalls == desc.numFrames);
+
+			// Each gizmo draws three shapes and each light one icon
+			const GizmoCullStats& cullStats = benchmark.getCullStats();
+			BS_TEST_ASSERT(cullStats.numShapesDrawn + cullStats.numShapesCulled == desc.numGizmos * 3);
+			BS_TEST_ASSERT(cullStats.numIconsDrawn + cullStats.numIconsCulled == desc.numLights);
+
+			const SceneViewBenchmarkStats& stats = benchmark.getStats(SceneViewBenchmarkStage::GizmoUpdate);
+			BS_TEST_ASSERT(stats.min <= stats.average && stats.average <= stats.max);
+
+			String json = benchmark.toJSON();
+			BS_TEST_ASSERT(json.find("\"GizmoUpdate\"") != String::npos);
+			BS_TEST_ASSERT(json.find("\"Selection\"") != String::npos);
+			BS_TEST_ASSERT(json.find("\"ScriptGizmos\"") != String::npos);
+			BS_TEST_ASSERT(json.find("\"SceneTree\"") != String::npos);
+
+			const SceneViewBenchmarkStats& treeStats = benchmark.getStats(SceneViewBenchmarkStage::SceneTree);
+			BS_TEST_ASSERT(treeStats.min <= treeStats.average && treeStats.average <= treeStats.max);
+		}
+
+		cameraSO->destroy();
+	}
+
+	void EditorTestSuite::UndoRedo_MemoryBudget()
+	{
+		SPtr<UndoRedo> undoRedo = bs_shared_ptr_new<UndoRedo>();
+		undoRedo->setMemoryBudget(550);
+
+		UINT32 numReverts = 0;
+		for (UINT32 i = 0; i < 10; i++)
+			undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+
+		BS_TEST_ASSERT(undoRedo->getMemoryUsage() == 500);
+
+		// Moving commands between the stacks doesn't change the total, removing them does
+		undoRedo->undo();
+		BS_TEST_ASSERT(undoRedo->getMemoryUsage() == 500);
+
+		undoRedo->popCommand(undoRedo->getTopCommandId());
+		BS_TEST_ASSERT(undoRedo->getMemoryUsage() == 400);
+
+		for (UINT32 i = 0; i < 10; i++)
+			undoRedo->undo();
+
+		// One revert from the first undo, and three from the commands that remained
+		BS_TEST_ASSERT(numReverts == 4);
+
+		// The most recent command is kept even if it doesn't fit in the budget
+		undoRedo->clear();
+		BS_TEST_ASSERT(undoRedo->getMemoryUsage() == 0);
+
+		undoRedo->setMemoryBudget(50);
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+
+		BS_TEST_ASSERT(undoRedo->getMemoryUsage() == 100);
+
+		// Evicting commands removes them from the groups they belong to, oldest groups first
+		undoRedo->clear();
+		undoRedo->setMemoryBudget(250);
+
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+		undoRedo->pushGroup("Outer");
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+		undoRedo->pushGroup("Inner");
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+
+		BS_TEST_ASSERT(undoRedo->getCommandInfo().size() == 2);
+
+		undoRedo->popGroup("Inner");
+		BS_TEST_ASSERT(undoRedo->getCommandInfo().empty());
+
+		undoRedo->popGroup("Outer");
+		BS_TEST_ASSERT(undoRedo->getCommandInfo().empty());
+		BS_TEST_ASSERT(undoRedo->getMemoryUsage() == 0);
+
+		// Commands that are undone and then redone past the cold depth become cold again
+		undoRedo->clear();
+		undoRedo->setMemoryBudget(0);
+
+		UINT32 numCold = 0;
+		undoRedo->registerCommand(bs_shared_ptr_new<TestColdCommand>(numCold));
+		for (UINT32 i = 0; i < 8; i++)
+			undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+
+		BS_TEST_ASSERT(numCold == 1);
+
+		for (UINT32 i = 0; i < 9; i++)
+			undoRedo->undo();
+
+		for (UINT32 i = 0; i < 9; i++)
+			undoRedo->redo();
+
+		BS_TEST_ASSERT(numCold == 2);
+	}
+
+	void EditorTestSuite::SerializedSceneObject_Sharing()
+	{
+		HSceneObject so = SceneObject::create("so");
+		GameObjectHandle<TestComponentB> cmp = so->addComponent<TestComponentB>();
+
+		for (UINT32 i = 0; i < 2048; i++)
+			cmp->val1 += "Value" + toString(i);
+
+		auto original = bs_shared_ptr_new<SerializedSceneObject>(so);
+		UINT64 originalUsage = original->getMemoryUsage();
+
+		// Changing the name shifts all the data following it, which shouldn't prevent the rest from being shared
+		so->setName("so_modified");
+		auto modified = bs_shared_ptr_new<SerializedSceneObject>(so);
+
+		UINT64 totalUsage = original->getMemoryUsage() + modified->getMemoryUsage();
+		BS_TEST_ASSERT(totalUsage < originalUsage + originalUsage / 2);
+
+		String originalValue = cmp->val1;
+		cmp->val1 = "Changed";
+
+		original->restore();
+		BS_TEST_ASSERT(so->getName() == "so");
+		BS_TEST_ASSERT(so->getComponent<TestComponentB>()->val1 == originalValue);
+
+		so->destroy();
+	}
+
+	void EditorTestSuite::SerializedSceneObject_Compress()
+	{
+		HSceneObject so = SceneObject::create("so");
+		GameObjectHandle<TestComponentB> cmp = so->addComponent<TestComponentB>();
+
+		for (UINT32 i = 0; i < 2048; i++)
+			cmp->val1 += "Value" + toString(i);
+
+		String originalValue = cmp->val1;
+
+		auto original = bs_shared_ptr_new<SerializedSceneObject>(so);
+		so->setName("so_modified");
+		auto modified = bs_shared_ptr_new<SerializedSceneObject>(so);
+
+		UINT64 sharedUsage = original->getMemoryUsage() + modified->getMemoryUsage();
+
+		// Chunks shared with the modified snapshot must remain usable while the original one is compressed
+		original->compress(true);
+		cmp->val1 = "Changed";
+
+		modified->restore();
+		BS_TEST_ASSERT(so->getName() == "so_modified");
+		BS_TEST_ASSERT(so->getComponent<TestComponentB>()->val1 == originalValue);
+
+		original->restore();
+		BS_TEST_ASSERT(so->getName() == "so");
+
+		// Compress both, so the shared chunks are compressed as well
+		original->compress(true);
+		modified->compress(false);
+
+		modified->restore();
+		BS_TEST_ASSERT(so->getName() == "so_modified");
+		BS_TEST_ASSERT(so->getComponent<TestComponentB>()->val1 == originalValue);
+
+		original->restore();
+		BS_TEST_ASSERT(so->getName() == "so");
+		BS_TEST_ASSERT(so->getComponent<TestComponentB>()->val1 == originalValue);
+
+		// Once decompressed the snapshots should still be sharing their chunks
+		UINT64 restoredUsage = original->getMemoryUsage() + modified->getMemoryUsage();
+		BS_TEST_ASSERT(restoredUsage == sharedUsage);
+
+		so->destroy();
+	}
+
+	void EditorTestSuite::TestBidirectionalDiff()
+	{
+		SPtr<TestObjectA> orgObj = bs_shared_ptr_new<TestObjectA>();
+		SPtr<TestObjectA> newObj = bs_shared_ptr_new<TestObjectA>();
+
+		newObj->intA = 995;
+		newObj->strA = "potato";
+		newObj->arrStrB = { "orange", "carrot" };
+		newObj->arrStrC = { "16", "17", "banana", "apple" };
+		newObj->objB.intA = 9940;
+		newObj->objPtrB->strA = "kiwi";
+		newObj->objPtrC = nullptr;
+		newObj->objPtrD = bs_shared_ptr_new<TestObjectB>();
+		newObj->arrObjB[1].strA = "strawberry";
+		newObj->arrObjPtrB[0]->intA = 99100;
+
+		SPtr<SerializedObject> orgSerialized = SerializedObject::create(*orgObj.get());
+		SPtr<SerializedObject> newSerialized = SerializedObject::create(*newObj.get());
+
+		SPtr<SerializedObject> forward;
+		SPtr<SerializedObject> reverse;
+		BS_TEST_ASSERT(BidirectionalDiff::generate(orgSerialized, newSerialized, forward, reverse));
+		BS_TEST_ASSERT(forward != nullptr && reverse != nullptr);
+
+		// Equal objects shouldn't produce any diffs
+		SPtr<SerializedObject> noForward;
+		SPtr<SerializedObject> noReverse;
+		BS_TEST_ASSERT(!BidirectionalDiff::generate(orgSerialized, orgSerialized, noForward, noReverse));
+		BS_TEST_ASSERT(noForward == nullptr && noReverse == nullptr);
+
+		// Apply the reverse diff to a copy of the new state, it should end up equal to the original
+		SPtr<TestObjectA> restoredObj = std::static_pointer_cast<TestObjectA>(newSerialized->decode());
+		SPtr<TestObjectA> expectedObj = bs_shared_ptr_new<TestObjectA>();
+
+		IDiff& diffHandler = restoredObj->getRTTI()->getDiffHandler();
+		diffHandler.applyDiff(restoredObj, reverse, nullptr);
+
+		BS_TEST_ASSERT(restoredObj->intA == expectedObj->intA);
+		BS_TEST_ASSERT(restoredObj->strA == expectedObj->strA);
+		BS_TEST_ASSERT(restoredObj->objB.intA == expectedObj->objB.intA);
+		BS_TEST_ASSERT(restoredObj->objPtrB->strA == expectedObj->objPtrB->strA);
+		BS_TEST_ASSERT(restoredObj->objPtrC != nullptr);
+		BS_TEST_ASSERT(restoredObj->objPtrD == nullptr);
+
+		BS_TEST_ASSERT(restoredObj->arrStrB.size() == expectedObj->arrStrB.size());
+		for (UINT32 i = 0; i < (UINT32)restoredObj->arrStrB.size(); i++)
+			BS_TEST_ASSERT(restoredObj->arrStrB[i] == expectedObj->arrStrB[i]);
+
+		BS_TEST_ASSERT(restoredObj->arrStrC.size() == expectedObj->arrStrC.size());
+		for (UINT32 i = 0; i < (UINT32)restoredObj->arrStrC.size(); i++)
+			BS_TEST_ASSERT(restoredObj->arrStrC[i] == expectedObj->arrStrC[i]);
+
+		BS_TEST_ASSERT(restoredObj->arrObjB[1].strA == expectedObj->arrObjB[1].strA);
+		BS_TEST_ASSERT(restoredObj->arrObjPtrB[0]->intA == expectedObj->arrObjPtrB[0]->intA);
+
+		// And the forward diff should still bring it back to the new state
+		diffHandler.applyDiff(restoredObj, forward, nullptr);
+
+		BS_TEST_ASSERT(restoredObj->intA == newObj->intA);
+		BS_TEST_ASSERT(restoredObj->arrStrC.size() == newObj->arrStrC.size());
+		BS_TEST_ASSERT(restoredObj->objPtrC == nullptr);
+		BS_TEST_ASSERT(restoredObj->objPtrD != nullptr);
+	}
+
+	void EditorTestSuite::SceneObjectDeleteMulti_UndoRedo()
+	{
+		SPtr<UndoRedo> undoRedo = bs_shared_ptr_new<UndoRedo>();
+		UndoRedo::_setOverride(undoRedo.get());
+
+		HSceneObject root = SceneObject::create("root");
+		HSceneObject other = SceneObject::create("other");
+		HSceneObject so0 = SceneObject::create("so0");
+		HSceneObject so1 = SceneObject::create("so1");
+		HSceneObject so0_0 = SceneObject::create("so0_0");
+		HSceneObject so2 = SceneObject::create("so2");
+
+		so0->setParent(root);
+		so1->setParent(root);
+		so0_0->setParent(so0);
+		so2->setParent(other);
+
+		so2->setPosition(Vector3(1.0f, 2.0f, 3.0f));
+
+		GameObjectHandle<TestComponentA> cmpA = so1->addComponent<TestComponentA>();
+		cmpA->ref1 = so0_0;
+
+		// so0_0 is deleted along with its parent, and shouldn't be restored twice. All objects should be restored by a
+		// single undo, under their original parents.
+		Vector<HSceneObject> toDelete = { so0, so0_0, so1, so2 };
+		CmdDeleteSO::execute(toDelete, "Delete");
+
+		BS_TEST_ASSERT(root->getNumChildren() == 0);
+		BS_TEST_ASSERT(other->getNumChildren() == 0);
+
+		undoRedo->undo();
+
+		BS_TEST_ASSERT(!so0.isDestroyed());
+		BS_TEST_ASSERT(!so1.isDestroyed());
+		BS_TEST_ASSERT(!so0_0.isDestroyed());
+		BS_TEST_ASSERT(!so2.isDestroyed());
+		BS_TEST_ASSERT(root->getNumChildren() == 2);
+		BS_TEST_ASSERT(so0->getNumChildren() == 1);
+		BS_TEST_ASSERT(so0_0->getParent() == so0);
+		BS_TEST_ASSERT(so2->getParent() == other);
+		BS_TEST_ASSERT(so2->getTransform().getPosition() == Vector3(1.0f, 2.0f, 3.0f));
+
+		GameObjectHandle<TestComponentA> restoredCmpA = so1->getComponent<TestComponentA>();
+		BS_TEST_ASSERT(restoredCmpA->ref1 == so0_0);
+
+		undoRedo->redo();
+		BS_TEST_ASSERT(root->getNumChildren() == 0);
+
+		undoRedo->undo();
+		BS_TEST_ASSERT(root->getNumChildren() == 2);
+		BS_TEST_ASSERT(so2->getParent() == other);
+
+		UndoRedo::_setOverride(nullptr);
+
+		root->destroy();
+		other->destroy();
+	}
+
+	void EditorTestSuite::TestUndoRedoBenchmark()
+	{
+		UINT32 topCommandId = UndoRedo::instance().getTopCommandId();
+
+		UndoRedoBenchmarkDesc desc;
+		desc.objectCounts = { 8, 32 };
+
+		UndoRedoBenchmark benchmark(desc);
+		benchmark.run();
+
+		const Vector<UndoRedoBenchmarkResult>& results = benchmark.getResults();
+		BS_TEST_ASSERT(results.size() == desc.objectCounts.size());
+		BS_TEST_ASSERT(benchmark.toJSON().find("\"Delete\"") != String::npos);
+
+		// Editor's undo stack shouldn't be affected
+		BS_TEST_ASSERT(UndoRedo::instance().getTopCommandId() == topCommandId);
+	}
+
+	void EditorTestSuite::UndoRedo_CommandInfo()
+	{
+		SPtr<UndoRedo> undoRedo = bs_shared_ptr_new<UndoRedo>();
+		UndoRedo::_setOverride(undoRedo.get());
+
+		// Zero identifies an empty stack, so it must never be assigned to a command
+		BS_TEST_ASSERT(UndoRedo::instance().getTopCommandId() == 0);
+
+		UINT32 numReverts = 0;
+		UndoRedo::instance().registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts), true);
+		BS_TEST_ASSERT(UndoRedo::instance().getTopCommandId() != 0);
+
+		UndoRedo::instance().registerCommand(bs_shared_ptr_new<TestMemoryCommand>(200, numReverts));
+		UndoRedo::instance().registerCommand(bs_shared_ptr_new<TestMemoryCommand>(300, numReverts));
+		UndoRedo::instance().undo();
+
+		Vector<UndoRedoCommandInfo> commands = UndoRedo::instance().getCommandInfo();
+		BS_TEST_ASSERT(commands.size() == 3);
+
+		// Undo stack from most recent, followed by the redo stack
+		BS_TEST_ASSERT(commands[0].memoryUsage == 200 && !commands[0].isRedo);
+		BS_TEST_ASSERT(commands[1].memoryUsage == 100 && !commands[1].isRedo);
+		BS_TEST_ASSERT(commands[2].memoryUsage == 300 && commands[2].isRedo);
+
+		// Commits performed on registration are counted
+		BS_TEST_ASSERT(commands[1].numCommits == 1);
+		BS_TEST_ASSERT(commands[0].numCommits == 0);
+
+		BS_TEST_ASSERT(commands[2].numReverts == 1 && commands[2].numCommits == 0);
+		BS_TEST_ASSERT(commands[0].numReverts == 0);
+		BS_TEST_ASSERT(commands[0].type == "EditorCommand");
+		BS_TEST_ASSERT(commands[1].creationTime <= commands[0].creationTime);
+
+		UndoRedo::_setOverride(nullptr);
+	}
+
+	void EditorTestSuite::UndoRedo_Arena()
+	{
+		UINT32 numReverts = 0;
+
+		UndoRedoArena arena(4096);
+		Vector<SPtr<TestMemoryCommand>> commands;
+		for (UINT32 i = 0; i < 100; i++)
+			commands.push_back(arena.newShared<TestMemoryCommand>(100, numReverts));
+
+		// One allocation for the command and one for the shared pointer control block
+		BS_TEST_ASSERT(arena.getNumAllocations() == 200);
+		BS_TEST_ASSERT(arena.getNumChunkAllocations() < 20);
+
+		// Only the active and the spare chunk are kept once empty
+		commands.clear();
+		BS_TEST_ASSERT(arena.getNumChunks() <= 2);
+
+		UINT64 numChunkAllocations = arena.getNumChunkAllocations();
+		for (UINT32 i = 0; i < 10; i++)
+			commands.push_back(arena.newShared<TestMemoryCommand>(100, numReverts));
+
+		commands.clear();
+		BS_TEST_ASSERT(arena.getNumChunkAllocations() == numChunkAllocations);
+
+		// Allocations may outlive their arena
+		UndoRedoArena* tempArena = bs_new<UndoRedoArena>();
+		SPtr<TestMemoryCommand> command = tempArena->newShared<TestMemoryCommand>(100, numReverts);
+		bs_delete(tempArena);
+		command = nullptr;
+
+		// Groups allocate from their own arena
+		SPtr<UndoRedo> localUndoRedo = bs_shared_ptr_new<UndoRedo>();
+		UndoRedo::_setOverride(localUndoRedo.get());
+
+		UndoRedo& undoRedo = UndoRedo::instance();
+		UndoRedoArena* globalArena = &undoRedo.getActiveArena();
+
+		undoRedo.pushGroup("ArenaTest");
+		UndoRedoArena& groupArena = undoRedo.getActiveArena();
+		BS_TEST_ASSERT(&groupArena != globalArena);
+
+		for (UINT32 i = 0; i < 10; i++)
+			undoRedo.registerCommand(groupArena.newShared<TestMemoryCommand>(100, numReverts));
+
+		BS_TEST_ASSERT(groupArena.getNumAllocations() == 20);
+		undoRedo.popGroup("ArenaTest");
+
+		BS_TEST_ASSERT(&undoRedo.getActiveArena() == globalArena);
+
+		UndoRedo::_setOverride(nullptr);
+	}
+
+	void EditorTestSuite::UndoRedo_PopCommand()
+	{
+		SPtr<UndoRedo> undoRedo = bs_shared_ptr_new<UndoRedo>();
+
+		UINT32 numReverts = 0;
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(100, numReverts));
+		UINT32 outsideId = undoRedo->getTopCommandId();
+
+		undoRedo->pushGroup("PopCommandTest");
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(200, numReverts));
+		undoRedo->registerCommand(bs_shared_ptr_new<TestMemoryCommand>(300, numReverts));
+		undoRedo->popCommand(undoRedo->getTopCommandId());
+
+		// Popping the group must only remove the command remaining in it
+		undoRedo->popGroup("PopCommandTest");
+		BS_TEST_ASSERT(undoRedo->getTopCommandId() == outsideId);
+		BS_TEST_ASSERT(undoRedo->getMemoryUsage() == 100);
+
+		// Popping the identifier of an empty stack must not remove anything
+		undoRedo->undo();
+		BS_TEST_ASSERT(undoRedo->getTopCommandId() == 0);
+
+		undoRedo->popCommand(0);
+		undoRedo->redo();
+		BS_TEST_ASSERT(undoRedo->getTopCommandId() == outsideId);
+	}
+
+	void EditorTestSuite::TestSceneSaveBenchmark()
+	{
+		SceneSaveBenchmarkDesc desc;
+		desc.objectCounts = { 8, 32 };
+
+		SceneSaveBenchmark benchmark(desc);
+		benchmark.run();
+
+		const Vector<SceneSaveBenchmarkResult>& results = benchmark.getResults();
+		BS_TEST_ASSERT(results.size() == desc.objectCounts.size());
+
+		// Larger scenes must produce larger files
+		BS_TEST_ASSERT(results[0].fileSize > 0);
+		BS_TEST_ASSERT(results[1].fileSize > results[0].fileSize);
+		BS_TEST_ASSERT(benchmark.toJSON().find("\"snapshotMs\"") != String::npos);
+	}
 }
@@ -93,6 +93,48 @@ namespace bs
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests insertion, refitting, removal and ray queries of the scene bounding volume hierarchy. */
+		void TestSceneBVH();
+
+		/** Tests that the CPU picking backend finds renderables and follows reported scene modifications. */
+		void TestScenePickingCPU();
+
+		/** Tests that cached scene bounds, and bounds aggregated over hierarchies, follow reported scene modifications. */
+		void TestSceneBoundsCache();
+
+		/** Runs a small scene view benchmark, making sure all stages run and the results are reported. */
+		void TestSceneViewBenchmark();
+
+		/** Tests that the undo stack discards its oldest commands when over the memory budget. */
+		void UndoRedo_MemoryBudget();
+
+		/** Tests that repeated snapshots of the same scene object share the parts that didn't change. */
+		void SerializedSceneObject_Sharing();
+
+		/** Tests that compressing snapshots keeps their chunks shared and restores them correctly. */
+		void SerializedSceneObject_Compress();
+
+		/** Tests that the reverse diff generated alongside a forward diff restores the original object. */
+		void TestBidirectionalDiff();
+
+		/** Tests deleting multiple objects with a single command. */
+		void SceneObjectDeleteMulti_UndoRedo();
+
+		/** Runs the undo/redo benchmark with small object counts. */
+		void TestUndoRedoBenchmark();
+
+		/** Tests that the undo/redo stack reports information about the commands it contains. */
+		void UndoRedo_CommandInfo();
+
+		/** Tests that commands allocated from an undo/redo arena share chunks, and that the chunks are released. */
+		void UndoRedo_Arena();
+
+		/** Tests removing commands from the middle of the undo stack, from within a group. */
+		void UndoRedo_PopCommand();
+
+		/** Runs the scene save benchmark with small object counts. */
+		void TestSceneSaveBenchmark();
 	};
 
 	/** @} */
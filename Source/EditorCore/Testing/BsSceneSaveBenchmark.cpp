@@ -0,0 +1,93 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Testing/BsSceneSaveBenchmark.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsPrefab.h"
+#include "Resources/BsResources.h"
+#include "FileSystem/BsFileSystem.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	SceneSaveBenchmark::SceneSaveBenchmark(const SceneSaveBenchmarkDesc& desc)
+		:mDesc(desc)
+	{ }
+
+	void SceneSaveBenchmark::run()
+	{
+		mResults.clear();
+
+		Path outputPath = mDesc.outputPath;
+		if (outputPath.isEmpty())
+			outputPath = Path::combine(FileSystem::getTempDirectoryPath(), "SceneSaveBenchmark.asset");
+
+		for (auto& numObjects : mDesc.objectCounts)
+			mResults.push_back(runSingle(numObjects, outputPath));
+
+		FileSystem::remove(outputPath);
+	}
+
+	SceneSaveBenchmarkResult SceneSaveBenchmark::runSingle(UINT32 numObjects, const Path& outputPath)
+	{
+		SceneSaveBenchmarkResult result;
+		result.numObjects = numObjects;
+
+		HSceneObject root = SceneObject::create("SceneSaveBenchmark");
+		for (UINT32 i = 0; i < numObjects; i++)
+		{
+			HSceneObject so = SceneObject::create("Object");
+			so->setParent(root);
+			so->setPosition(Vector3((float)i, 0.0f, 0.0f));
+
+			for (UINT32 j = 0; j < mDesc.childrenPerObject; j++)
+			{
+				HSceneObject child = SceneObject::create("Child");
+				child->setParent(so);
+			}
+		}
+
+		Timer timer;
+		auto measure = [&](const std::function<void()>& func)
+		{
+			UINT64 startTime = timer.getMicroseconds();
+			func();
+
+			return (timer.getMicroseconds() - startTime) / 1000.0f;
+		};
+
+		// Saving over an existing scene updates its prefab, so only time the update and not the initial creation
+		HPrefab prefab = Prefab::create(root, true);
+		result.snapshot = measure([&]() { prefab->update(root); });
+
+		SPtr<Resource> prefabPtr = prefab.getInternalPtr();
+		result.write = measure([&]() { gResources()._save(prefabPtr, outputPath, false); });
+		result.fileSize = FileSystem::getFileSize(outputPath);
+
+		gResources().release(prefab);
+		root->destroy(true);
+
+		return result;
+	}
+
+	String SceneSaveBenchmark::toJSON() const
+	{
+		StringStream output;
+		output << "{\"childrenPerObject\":" << mDesc.childrenPerObject << ",\"results\":[";
+
+		for (UINT32 i = 0; i < (UINT32)mResults.size(); i++)
+		{
+			const SceneSaveBenchmarkResult& result = mResults[i];
+
+			if (i > 0)
+				output << ",";
+
+			output << "{\"objects\":" << result.numObjects << ","
+				<< "\"snapshotMs\":" << result.snapshot << ","
+				<< "\"writeMs\":" << result.write << ","
+				<< "\"fileBytes\":" << result.fileSize << "}";
+		}
+
+		output << "]}";
+		return output.str();
+	}
+}
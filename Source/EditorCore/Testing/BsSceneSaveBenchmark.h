@@ -0,0 +1,75 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Testing/BsEditorBenchmark.h"
+
+namespace bs
+{
+	/** @addtogroup Testing-Editor
+	 *  @{
+	 */
+
+	/** Parameters used by SceneSaveBenchmark. */
+	struct SceneSaveBenchmarkDesc
+	{
+		/** Number of top level objects in the saved scene. The benchmark is ran once for each entry. */
+		Vector<UINT32> objectCounts = { 1000, 10000, 100000 };
+
+		/** Number of children each of the top level objects has. */
+		UINT32 childrenPerObject = 1;
+
+		/** File to save the scene to. The file is deleted once the run finishes. If empty a temporary file is used. */
+		Path outputPath;
+	};
+
+	/** Results of the benchmark for a single object count. Times are in milliseconds. */
+	struct SceneSaveBenchmarkResult
+	{
+		UINT32 numObjects = 0;
+
+		/** Time to update the scene prefab from the scene. This part of a save always runs on the main thread. */
+		float snapshot = 0.0f;
+
+		/**
+		 * Time to encode the prefab and write it to disk, through the same path ProjectLibrary::saveEntry() uses. This
+		 * part of a save runs on a worker thread when saving asynchronously, but is measured on the calling thread.
+		 */
+		float write = 0.0f;
+
+		/** Size of the saved file in bytes. */
+		UINT64 fileSize = 0;
+	};
+
+	/**
+	 * Measures the cost of saving scenes of various sizes, split into the part that blocks the main thread and the part
+	 * that can run on a worker. Results can be exported as JSON for comparison between runs.
+	 *
+	 * @note	Runs in-process on the calling thread. Objects of the saved scene are temporarily added to the main
+	 *			scene.
+	 */
+	class BS_ED_EXPORT SceneSaveBenchmark : public EditorBenchmark
+	{
+	public:
+		SceneSaveBenchmark(const SceneSaveBenchmarkDesc& desc);
+
+		/** Runs the benchmark for all the object counts. Results from any previous runs are discarded. */
+		void run();
+
+		/** Returns the results of the last run, one for each object count. */
+		const Vector<SceneSaveBenchmarkResult>& getResults() const { return mResults; }
+
+		/** @copydoc EditorBenchmark::toJSON */
+		String toJSON() const override;
+
+	private:
+		/** Creates, saves and destroys a scene with the specified number of top level objects. */
+		SceneSaveBenchmarkResult runSingle(UINT32 numObjects, const Path& outputPath);
+
+		SceneSaveBenchmarkDesc mDesc;
+		Vector<SceneSaveBenchmarkResult> mResults;
+	};
+
+	/** @} */
+}
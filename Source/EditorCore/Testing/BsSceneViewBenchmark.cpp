@@ -0,0 +1,355 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Testing/BsSceneViewBenchmark.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsSelection.h"
+#include "Scene/BsSelectionRenderer.h"
+#include "Handles/BsHandleManager.h"
+#include "Utility/BsEditorUtility.h"
+#include "Components/BsCRenderable.h"
+#include "Components/BsCLight.h"
+#include "Resources/BsBuiltinResources.h"
+#include "Image/BsSpriteTexture.h"
+#include "RenderAPI/BsViewport.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Utility/BsTimer.h"
+#include "Utility/BsBuiltinEditorResources.h"
+#include "Scene/BsSceneChangeNotifier.h"
+#include "GUI/BsGUISceneTreeView.h"
+#include "GUI/BsCGUIWidget.h"
+#include "GUI/BsGUIPanel.h"
+
+namespace bs
+{
+	/** Names of the benchmark stages, as written in the JSON output. */
+	static const char* STAGE_NAMES[(UINT32)SceneViewBenchmarkStage::Count] =
+		{ "Scene", "ScriptGizmos", "GizmoRecord", "GizmoUpdate", "Handles", "Selection", "Bounds", "SceneTree" };
+
+	/** Minimal xorshift generator, so generated scenes only depend on the seed and not on the platform. */
+	class BenchmarkRandom
+	{
+	public:
+		BenchmarkRandom(UINT32 seed)
+			:mState(seed * 2654435761U + 1)
+		{ }
+
+		/** Returns a random value in range [0, 1]. */
+		float getUNorm()
+		{
+			mState ^= mState << 13;
+			mState ^= mState >> 17;
+			mState ^= mState << 5;
+
+			return (mState & 0xFFFFFF) / (float)0xFFFFFF;
+		}
+
+		/** Returns a random value in range [-1, 1]. */
+		float getSNorm() { return getUNorm() * 2.0f - 1.0f; }
+
+	private:
+		UINT32 mState;
+	};
+
+	SceneViewBenchmark::SceneViewBenchmark(const SceneViewBenchmarkDesc& desc)
+		:mDesc(desc)
+	{
+		createScene();
+	}
+
+	SceneViewBenchmark::~SceneViewBenchmark()
+	{
+		destroyScene();
+	}
+
+	void SceneViewBenchmark::run(const SPtr<Camera>& camera)
+	{
+		UINT64 totalTimes[(UINT32)SceneViewBenchmarkStage::Count];
+		UINT64 minTimes[(UINT32)SceneViewBenchmarkStage::Count];
+		UINT64 maxTimes[(UINT32)SceneViewBenchmarkStage::Count];
+		UINT64 totalAllocs[(UINT32)SceneViewBenchmarkStage::Count];
+
+		for (UINT32 i = 0; i < (UINT32)SceneViewBenchmarkStage::Count; i++)
+		{
+			totalTimes[i] = 0;
+			minTimes[i] = std::numeric_limits<UINT64>::max();
+			maxTimes[i] = 0;
+			totalAllocs[i] = 0;
+		}
+
+		Timer timer;
+		auto measure = [&](SceneViewBenchmarkStage stage, const std::function<void()>& func)
+		{
+			UINT32 idx = (UINT32)stage;
+
+			UINT64 startAllocs = MemoryCounter::getNumAllocs();
+			UINT64 startTime = timer.getMicroseconds();
+
+			func();
+
+			UINT64 duration = timer.getMicroseconds() - startTime;
+			totalTimes[idx] += duration;
+			minTimes[idx] = std::min(minTimes[idx], duration);
+			maxTimes[idx] = std::max(maxTimes[idx], duration);
+			totalAllocs[idx] += MemoryCounter::getNumAllocs() - startAllocs;
+		};
+
+		Vector<HSceneObject> oldSelection = Selection::instance().getSceneObjects();
+		Selection::instance().setSceneObjects(mSelected);
+
+		SelectionRenderer* selectionRenderer = bs_new<SelectionRenderer>();
+
+		// Scene tree view needs to be part of a widget in order to have a style
+		HSceneObject treeViewSO = SceneObject::create("SceneViewBenchmarkGUI",
+			SOF_Internal | SOF_Persistent | SOF_DontSave);
+		HGUIWidget treeViewWidget = treeViewSO->addComponent<CGUIWidget>(camera);
+		treeViewWidget->setSkin(BuiltinEditorResources::instance().getSkin());
+
+		GUISceneTreeView* treeView = GUISceneTreeView::create();
+		treeViewWidget->getPanel()->addElement(treeView);
+
+		GizmoDrawSettings drawSettings;
+		drawSettings.shapeRange = mDesc.sceneExtent;
+
+		Rect2I viewArea = camera->getViewport()->getPixelArea();
+		Vector2I lastInputPos(viewArea.x, viewArea.y);
+
+		for (UINT32 i = 0; i < mDesc.numFrames; i++)
+		{
+			measure(SceneViewBenchmarkStage::Scene, [&]() { moveObjects(i); });
+
+			// Managed gizmo update clears any previous gizmos by itself
+			if (mScriptGizmoCallback)
+				measure(SceneViewBenchmarkStage::ScriptGizmos, mScriptGizmoCallback);
+			else
+				GizmoManager::instance().clearGizmos();
+
+			measure(SceneViewBenchmarkStage::GizmoRecord, [&]() { recordGizmos(); });
+			measure(SceneViewBenchmarkStage::GizmoUpdate, [&]()
+			{
+				GizmoManager::instance().update(camera, drawSettings);
+			});
+
+			// Sweep the pointer diagonally across the viewport, so slider intersection tests run over different areas
+			float t = mDesc.numFrames > 1 ? i / (float)(mDesc.numFrames - 1) : 0.0f;
+			Vector2I inputPos(viewArea.x + (INT32)(viewArea.width * t), viewArea.y + (INT32)(viewArea.height * t));
+
+			// Handle manager is provided by the scripting layer and might not be running yet
+			if (HandleManager::isStarted())
+			{
+				measure(SceneViewBenchmarkStage::Handles, [&]()
+				{
+					HandleManager& handleManager = HandleManager::instance();
+					handleManager.beginInput();
+					handleManager.updateInput(camera, inputPos, inputPos - lastInputPos);
+					handleManager.endInput();
+					handleManager.draw(camera);
+				});
+			}
+
+			lastInputPos = inputPos;
+
+			measure(SceneViewBenchmarkStage::Selection, [&]() { selectionRenderer->update(camera); });
+			measure(SceneViewBenchmarkStage::Bounds, [&]()
+			{
+				EditorUtility::calculateHierarchyBounds(mSelected);
+				EditorUtility::calculateHierarchyCenter(mSelected);
+			});
+			measure(SceneViewBenchmarkStage::SceneTree, [&]() { treeView->_update(); });
+
+			// Don't let the core thread commands accumulate over the run, the core thread isn't being measured
+			gCoreThread().submit(true);
+		}
+
+		mCullStats = GizmoManager::instance().getCullStats();
+
+		bs_delete(selectionRenderer);
+		GUIElement::destroy(treeView);
+		treeViewSO->destroy();
+		GizmoManager::instance().clearGizmos();
+		Selection::instance().setSceneObjects(oldSelection);
+
+		for (UINT32 i = 0; i < (UINT32)SceneViewBenchmarkStage::Count; i++)
+		{
+			SceneViewBenchmarkStats& stats = mStats[i];
+			if (mDesc.numFrames > 0 && minTimes[i] <= maxTimes[i])
+			{
+				stats.total = totalTimes[i] / 1000.0f;
+				stats.average = stats.total / mDesc.numFrames;
+				stats.min = minTimes[i] / 1000.0f;
+				stats.max = maxTimes[i] / 1000.0f;
+				stats.allocations = totalAllocs[i] / (float)mDesc.numFrames;
+			}
+			else
+				stats = SceneViewBenchmarkStats();
+		}
+	}
+
+	String SceneViewBenchmark::toJSON() const
+	{
+		StringStream output;
+		output << "{\"scene\":{"
+			<< "\"emptyObjects\":" << mDesc.numEmptyObjects << ","
+			<< "\"renderables\":" << mDesc.numRenderables << ","
+			<< "\"lights\":" << mDesc.numLights << ","
+			<< "\"gizmos\":" << mDesc.numGizmos << ","
+			<< "\"selected\":" << mDesc.numSelected << ","
+			<< "\"movingFraction\":" << mDesc.movingFraction << ","
+			<< "\"extent\":" << mDesc.sceneExtent << ","
+			<< "\"seed\":" << mDesc.seed << "},";
+
+		output << "\"frames\":" << mDesc.numFrames << ",\"stages\":{";
+		for (UINT32 i = 0; i < (UINT32)SceneViewBenchmarkStage::Count; i++)
+		{
+			const SceneViewBenchmarkStats& stats = mStats[i];
+
+			if (i > 0)
+				output << ",";
+
+			output << "\"" << STAGE_NAMES[i] << "\":{"
+				<< "\"averageMs\":" << stats.average << ","
+				<< "\"minMs\":" << stats.min << ","
+				<< "\"maxMs\":" << stats.max << ","
+				<< "\"totalMs\":" << stats.total << ","
+				<< "\"allocationsPerFrame\":" << stats.allocations << "}";
+		}
+
+		output << "},\"gizmoCulling\":{"
+			<< "\"shapesDrawn\":" << mCullStats.numShapesDrawn << ","
+			<< "\"shapesCulled\":" << mCullStats.numShapesCulled << ","
+			<< "\"iconsDrawn\":" << mCullStats.numIconsDrawn << ","
+			<< "\"iconsCulled\":" << mCullStats.numIconsCulled << "}}";
+
+		return output.str();
+	}
+
+	void SceneViewBenchmark::createScene()
+	{
+		BenchmarkRandom random(mDesc.seed);
+
+		auto getRandomPosition = [&]()
+		{
+			float halfExtent = mDesc.sceneExtent * 0.5f;
+			return Vector3(random.getSNorm(), random.getSNorm(), random.getSNorm()) * halfExtent;
+		};
+
+		auto createObject = [&](const String& name)
+		{
+			HSceneObject so = SceneObject::create(name);
+
+			if (!mParents.empty())
+			{
+				UINT32 parentIdx = std::min((UINT32)(random.getUNorm() * mParents.size()), (UINT32)mParents.size() - 1);
+				so->setParent(mParents[parentIdx]);
+			}
+			else
+				so->setParent(mRoot);
+
+			so->setWorldPosition(getRandomPosition());
+			return so;
+		};
+
+		mRoot = SceneObject::create("SceneViewBenchmark");
+
+		for (UINT32 i = 0; i < mDesc.numEmptyObjects; i++)
+		{
+			HSceneObject so = SceneObject::create("Empty");
+			so->setParent(mRoot);
+			so->setWorldPosition(getRandomPosition());
+
+			mParents.push_back(so);
+		}
+
+		HMesh mesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+		for (UINT32 i = 0; i < mDesc.numRenderables; i++)
+		{
+			HSceneObject so = createObject("Renderable");
+
+			HRenderable renderable = so->addComponent<CRenderable>();
+			renderable->setMesh(mesh);
+
+			mRenderables.push_back(so);
+			mBasePositions.push_back(so->getTransform().getPosition());
+		}
+
+		for (UINT32 i = 0; i < mDesc.numLights; i++)
+		{
+			HSceneObject so = createObject("Light");
+			so->addComponent<CLight>();
+
+			mLights.push_back(so);
+		}
+
+		for (UINT32 i = 0; i < mDesc.numGizmos; i++)
+			mGizmos.push_back(createObject("Gizmo"));
+
+		UINT32 numSelected = std::min(mDesc.numSelected, (UINT32)mRenderables.size());
+		for (UINT32 i = 0; i < numSelected; i++)
+			mSelected.push_back(mRenderables[i]);
+
+		SceneChangeNotifier::instance().notifySceneChanged();
+	}
+
+	void SceneViewBenchmark::destroyScene()
+	{
+		if (!mRoot.isDestroyed())
+			mRoot->destroy();
+
+		SceneChangeNotifier::instance().notifySceneChanged();
+
+		mParents.clear();
+		mRenderables.clear();
+		mLights.clear();
+		mGizmos.clear();
+		mSelected.clear();
+		mBasePositions.clear();
+	}
+
+	void SceneViewBenchmark::moveObjects(UINT32 frameIdx)
+	{
+		UINT32 numMoving = (UINT32)(mRenderables.size() * Math::clamp01(mDesc.movingFraction));
+		if (numMoving == 0)
+			return;
+
+		// Move a different subset of the objects each frame, in a small circle around their original position
+		UINT32 numObjects = (UINT32)mRenderables.size();
+		UINT32 start = (frameIdx * numMoving) % numObjects;
+
+		Radian angle(frameIdx * 0.1f);
+		Vector3 offset(Math::cos(angle), 0.0f, Math::sin(angle));
+
+		for (UINT32 i = 0; i < numMoving; i++)
+		{
+			UINT32 idx = (start + i) % numObjects;
+			mRenderables[idx]->setWorldPosition(mBasePositions[idx] + offset);
+
+			// Report the move, same as the handles do
+			SceneChangeNotifier::instance().notifyObjectChanged(mRenderables[idx]);
+		}
+	}
+
+	void SceneViewBenchmark::recordGizmos()
+	{
+		GizmoManager& gizmoManager = GizmoManager::instance();
+
+		for (auto& so : mGizmos)
+		{
+			gizmoManager.startGizmo(so);
+			gizmoManager.setPickable(false);
+			gizmoManager.setColor(Color::Green);
+			gizmoManager.setTransform(so->getWorldMatrix());
+			gizmoManager.drawWireCube(Vector3::ZERO, Vector3(0.5f, 0.5f, 0.5f));
+			gizmoManager.drawWireSphere(Vector3::ZERO, 0.75f);
+			gizmoManager.drawLine(Vector3::ZERO, Vector3::UNIT_Y);
+			gizmoManager.endGizmo();
+		}
+
+		HSpriteTexture icon = BuiltinResources::instance().getWhiteSpriteTexture();
+		for (auto& so : mLights)
+		{
+			gizmoManager.startGizmo(so);
+			gizmoManager.setPickable(true);
+			gizmoManager.drawIcon(so->getTransform().getPosition(), icon, false);
+			gizmoManager.endGizmo();
+		}
+	}
+}
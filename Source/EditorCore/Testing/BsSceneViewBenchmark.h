@@ -0,0 +1,147 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Testing/BsEditorBenchmark.h"
+#include "Scene/BsGizmoManager.h"
+
+namespace bs
+{
+	/** @addtogroup Testing-Editor
+	 *  @{
+	 */
+
+	/** Parameters of the synthetic scene and run length used by SceneViewBenchmark. */
+	struct SceneViewBenchmarkDesc
+	{
+		/** Number of scene objects without any components, used as parents for the other objects. */
+		UINT32 numEmptyObjects = 100;
+
+		/** Number of scene objects with a Renderable component. */
+		UINT32 numRenderables = 1000;
+
+		/** Number of scene objects with a Light component. Each one also draws an icon gizmo. */
+		UINT32 numLights = 100;
+
+		/** Number of scene objects that draw custom shape gizmos every frame. */
+		UINT32 numGizmos = 500;
+
+		/** Number of renderable objects to select. */
+		UINT32 numSelected = 50;
+
+		/** Fraction of objects in range [0, 1] that are moved every frame. */
+		float movingFraction = 0.1f;
+
+		/** Objects are placed randomly within a cube of this size, centered at the origin. */
+		float sceneExtent = 100.0f;
+
+		/** Number of frames to run the benchmark for. */
+		UINT32 numFrames = 100;
+
+		/** Seed used for generating the scene. Equal seeds result in equal scenes. */
+		UINT32 seed = 0;
+	};
+
+	/** Editor subsystems timed individually by SceneViewBenchmark. */
+	enum class SceneViewBenchmarkStage
+	{
+		/** Moving objects around the scene, including transform updates and change notifications. */
+		Scene,
+		/** Drawing gizmos of managed components. Only measured if a callback was provided through
+		 * SceneViewBenchmark::setScriptGizmoCallback(). */
+		ScriptGizmos,
+		/** Recording custom gizmos through the GizmoManager. */
+		GizmoRecord,
+		/** GizmoManager::update(). */
+		GizmoUpdate,
+		/** Handle input and drawing, including HandleSliderManager::update(). */
+		Handles,
+		/** SelectionRenderer::update(). */
+		Selection,
+		/** Selection bounds and center calculations, as used for framing and handle placement. */
+		Bounds,
+		/** Updating a scene tree view (as used by the hierarchy window) to reflect the scene. */
+		SceneTree,
+		Count // Keep at end
+	};
+
+	/** Timings and allocations of a single SceneViewBenchmark stage. Times are in milliseconds. */
+	struct SceneViewBenchmarkStats
+	{
+		float average = 0.0f;
+		float min = 0.0f;
+		float max = 0.0f;
+		float total = 0.0f;
+
+		/** Average number of allocations per frame. Only counted when the engine is built with profiling enabled. */
+		float allocations = 0.0f;
+	};
+
+	/**
+	 * Measures the CPU overhead of the editor's per-frame scene view path. Generates a synthetic scene according to the
+	 * provided description, then runs the gizmo, handle, selection, bounds and scene tree updates for a number of
+	 * frames and records per-stage timings and allocation counts. Results can be exported as JSON for comparison between
+	 * runs.
+	 *
+	 * @note	Runs in-process on the main thread and temporarily replaces the current selection.
+	 */
+	class BS_ED_EXPORT SceneViewBenchmark : public EditorBenchmark
+	{
+	public:
+		SceneViewBenchmark(const SceneViewBenchmarkDesc& desc);
+		~SceneViewBenchmark();
+
+		/**
+		 * Runs the benchmark for the number of frames specified in the description. Results from any previous runs are
+		 * discarded.
+		 *
+		 * @param[in]	camera	Camera to use as the scene view camera. Should have a valid render target.
+		 */
+		void run(const SPtr<Camera>& camera);
+
+		/** 
+		 * Sets a callback that draws the gizmos of managed components, normally ScriptGizmoManager::update(). The
+		 * scripting layer is built on top of the editor core, so it has to be provided by the caller. The callback is
+		 * timed as the ScriptGizmos stage.
+		 */
+		void setScriptGizmoCallback(std::function<void()> callback) { mScriptGizmoCallback = std::move(callback); }
+
+		/** Returns the statistics for the specified stage, as recorded by the last run. */
+		const SceneViewBenchmarkStats& getStats(SceneViewBenchmarkStage stage) const { return mStats[(UINT32)stage]; }
+
+		/** Returns gizmo culling statistics from the last frame of the last run. */
+		const GizmoCullStats& getCullStats() const { return mCullStats; }
+
+		/** @copydoc EditorBenchmark::toJSON */
+		String toJSON() const override;
+
+	private:
+		/** Populates the scene according to the benchmark description. */
+		void createScene();
+
+		/** Destroys all objects created by createScene(). */
+		void destroyScene();
+
+		/** Moves a subset of the objects to a new location, different for each frame. */
+		void moveObjects(UINT32 frameIdx);
+
+		/** Records gizmos for all the gizmo and light objects. */
+		void recordGizmos();
+
+		SceneViewBenchmarkDesc mDesc;
+		SceneViewBenchmarkStats mStats[(UINT32)SceneViewBenchmarkStage::Count];
+		GizmoCullStats mCullStats;
+		std::function<void()> mScriptGizmoCallback;
+
+		HSceneObject mRoot;
+		Vector<HSceneObject> mParents;
+		Vector<HSceneObject> mRenderables;
+		Vector<HSceneObject> mLights;
+		Vector<HSceneObject> mGizmos;
+		Vector<HSceneObject> mSelected;
+		Vector<Vector3> mBasePositions;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,195 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Testing/BsUndoRedoBenchmark.h"
+#include "UndoRedo/BsUndoRedo.h"
+#include "UndoRedo/BsCmdCloneSO.h"
+#include "UndoRedo/BsCmdReparentSO.h"
+#include "UndoRedo/BsCmdDeleteSO.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Scene/BsSelection.h"
+#include "Scene/BsSceneChangeNotifier.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	/** Names of the benchmarked operations, as written in the JSON output. */
+	static const char* OPERATION_NAMES[(UINT32)UndoRedoBenchmarkOperation::Count] = { "Clone", "Reparent", "Delete" };
+
+	UndoRedoBenchmark::UndoRedoBenchmark(const UndoRedoBenchmarkDesc& desc)
+		:mDesc(desc)
+	{ }
+
+	void UndoRedoBenchmark::run()
+	{
+		mResults.clear();
+
+		Vector<HSceneObject> oldSelection = Selection::instance().getSceneObjects();
+
+		// Commands executed during the run end up on this stack instead of the editor-wide one
+		SPtr<UndoRedo> undoRedo = bs_shared_ptr_new<UndoRedo>();
+		UndoRedo::_setOverride(undoRedo.get());
+
+		for (auto& numObjects : mDesc.objectCounts)
+			mResults.push_back(runSingle(numObjects));
+
+		UndoRedo::_setOverride(nullptr);
+		undoRedo = nullptr;
+
+		Selection::instance().setSceneObjects(oldSelection);
+
+		// The local stack doesn't report its changes
+		SceneChangeNotifier::instance().notifySceneChanged();
+	}
+
+	UndoRedoBenchmarkResult UndoRedoBenchmark::runSingle(UINT32 numObjects)
+	{
+		UndoRedoBenchmarkResult result;
+		result.numObjects = numObjects;
+
+		HSceneObject root = SceneObject::create("UndoRedoBenchmark");
+		HSceneObject target = SceneObject::create("UndoRedoBenchmarkTarget");
+
+		Vector<HSceneObject> objects(numObjects);
+		for (UINT32 i = 0; i < numObjects; i++)
+		{
+			objects[i] = SceneObject::create("Object");
+			objects[i]->setParent(root);
+
+			for (UINT32 j = 0; j < mDesc.childrenPerObject; j++)
+			{
+				HSceneObject child = SceneObject::create("Child");
+				child->setParent(objects[i]);
+			}
+		}
+
+		Timer timer;
+		auto measure = [&](const std::function<void()>& func)
+		{
+			UINT64 startTime = timer.getMicroseconds();
+			func();
+
+			return (timer.getMicroseconds() - startTime) / 1000.0f;
+		};
+
+		// Objects destroyed by a command are only queued for destruction, make sure that cost isn't attributed to the
+		// next operation
+		auto flushDestroyed = [&]()
+		{
+			GameObjectManager::instance().destroyQueuedObjects();
+		};
+
+		UndoRedo& undoRedo = UndoRedo::instance();
+
+		// Batched, all objects handled by a single command
+		{
+			UndoRedoBenchmarkTimes& times = result.batched[(UINT32)UndoRedoBenchmarkOperation::Clone];
+			times.execute = measure([&]() { CmdCloneSO::execute(objects); });
+
+			times.undo = measure([&]() { undoRedo.undo(); });
+			flushDestroyed();
+
+			times.redo = measure([&]() { undoRedo.redo(); });
+			undoRedo.undo();
+			flushDestroyed();
+		}
+
+		{
+			UndoRedoBenchmarkTimes& times = result.batched[(UINT32)UndoRedoBenchmarkOperation::Reparent];
+			times.execute = measure([&]() { CmdReparentSO::execute(objects, target); });
+
+			times.undo = measure([&]() { undoRedo.undo(); });
+			times.redo = measure([&]() { undoRedo.redo(); });
+			undoRedo.undo();
+		}
+
+		{
+			UndoRedoBenchmarkTimes& times = result.batched[(UINT32)UndoRedoBenchmarkOperation::Delete];
+			times.execute = measure([&]() { CmdDeleteSO::execute(objects); });
+			flushDestroyed();
+
+			times.undo = measure([&]() { undoRedo.undo(); });
+			times.redo = measure([&]() { undoRedo.redo(); });
+			flushDestroyed();
+
+			undoRedo.undo();
+		}
+
+		// One command per object
+		if (mDesc.measureIndividual)
+		{
+			Vector<HSceneObject> clones(numObjects);
+			result.individual[(UINT32)UndoRedoBenchmarkOperation::Clone] = measure([&]()
+			{
+				for (UINT32 i = 0; i < numObjects; i++)
+					clones[i] = CmdCloneSO::execute(objects[i]);
+			});
+
+			for (auto& clone : clones)
+			{
+				if (!clone.isDestroyed())
+					clone->destroy(true);
+			}
+
+			result.individual[(UINT32)UndoRedoBenchmarkOperation::Reparent] = measure([&]()
+			{
+				for (UINT32 i = 0; i < numObjects; i++)
+					CmdReparentSO::execute(objects[i], target);
+			});
+
+			for (auto& object : objects)
+				object->setParent(root);
+
+			result.individual[(UINT32)UndoRedoBenchmarkOperation::Delete] = measure([&]()
+			{
+				for (UINT32 i = 0; i < numObjects; i++)
+					CmdDeleteSO::execute(objects[i]);
+			});
+
+			flushDestroyed();
+		}
+
+		root->destroy(true);
+		target->destroy(true);
+
+		return result;
+	}
+
+	String UndoRedoBenchmark::toJSON() const
+	{
+		StringStream output;
+		output << "{\"childrenPerObject\":" << mDesc.childrenPerObject << ",\"results\":[";
+
+		for (UINT32 i = 0; i < (UINT32)mResults.size(); i++)
+		{
+			const UndoRedoBenchmarkResult& result = mResults[i];
+
+			if (i > 0)
+				output << ",";
+
+			output << "{\"objects\":" << result.numObjects << ",\"operations\":{";
+			for (UINT32 j = 0; j < (UINT32)UndoRedoBenchmarkOperation::Count; j++)
+			{
+				const UndoRedoBenchmarkTimes& times = result.batched[j];
+
+				if (j > 0)
+					output << ",";
+
+				output << "\"" << OPERATION_NAMES[j] << "\":{"
+					<< "\"executeMs\":" << times.execute << ","
+					<< "\"undoMs\":" << times.undo << ","
+					<< "\"redoMs\":" << times.redo;
+
+				if (mDesc.measureIndividual)
+					output << ",\"individualExecuteMs\":" << result.individual[j];
+
+				output << "}";
+			}
+
+			output << "}}";
+		}
+
+		output << "]}";
+		return output.str();
+	}
+}
@@ -0,0 +1,94 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Testing/BsEditorBenchmark.h"
+
+namespace bs
+{
+	/** @addtogroup Testing-Editor
+	 *  @{
+	 */
+
+	/** Parameters used by UndoRedoBenchmark. */
+	struct UndoRedoBenchmarkDesc
+	{
+		/** Number of objects to operate on. The benchmark is ran once for each entry. */
+		Vector<UINT32> objectCounts = { 1000, 10000, 100000 };
+
+		/** Number of children each of the operated on objects has. */
+		UINT32 childrenPerObject = 1;
+
+		/**
+		 * If true the operations will also be timed when executed as one command per object, for comparison with the
+		 * batched commands. Only the execution is timed in this case, as the undo stack can't hold all the commands
+		 * for large object counts.
+		 */
+		bool measureIndividual = true;
+	};
+
+	/** Multi-object editor operations timed by UndoRedoBenchmark. */
+	enum class UndoRedoBenchmarkOperation
+	{
+		/** CmdCloneSO. */
+		Clone,
+		/** CmdReparentSO. */
+		Reparent,
+		/** CmdDeleteSO. */
+		Delete,
+		Count // Keep at end
+	};
+
+	/** Timings of a single operation. Times are in milliseconds. */
+	struct UndoRedoBenchmarkTimes
+	{
+		float execute = 0.0f;
+		float undo = 0.0f;
+		float redo = 0.0f;
+	};
+
+	/** Results of the benchmark for a single object count. */
+	struct UndoRedoBenchmarkResult
+	{
+		UINT32 numObjects = 0;
+
+		/** Timings when all objects are handled by a single command. */
+		UndoRedoBenchmarkTimes batched[(UINT32)UndoRedoBenchmarkOperation::Count];
+
+		/** Time in milliseconds to execute one command per object. Zero if not measured. */
+		float individual[(UINT32)UndoRedoBenchmarkOperation::Count] = { };
+	};
+
+	/**
+	 * Measures the cost of cloning, reparenting and deleting large selections of scene objects through the undo/redo
+	 * system, including the cost of undoing and redoing the operations. Results can be exported as JSON for comparison
+	 * between runs.
+	 *
+	 * @note	Runs in-process on the main thread. Commands are registered with a separate undo/redo stack, so the
+	 *			editor's undo history isn't affected.
+	 */
+	class BS_ED_EXPORT UndoRedoBenchmark : public EditorBenchmark
+	{
+	public:
+		UndoRedoBenchmark(const UndoRedoBenchmarkDesc& desc);
+
+		/** Runs the benchmark for all the object counts. Results from any previous runs are discarded. */
+		void run();
+
+		/** Returns the results of the last run, one for each object count. */
+		const Vector<UndoRedoBenchmarkResult>& getResults() const { return mResults; }
+
+		/** @copydoc EditorBenchmark::toJSON */
+		String toJSON() const override;
+
+	private:
+		/** Runs all the operations for the specified number of objects. */
+		UndoRedoBenchmarkResult runSingle(UINT32 numObjects);
+
+		UndoRedoBenchmarkDesc mDesc;
+		Vector<UndoRedoBenchmarkResult> mResults;
+	};
+
+	/** @} */
+}
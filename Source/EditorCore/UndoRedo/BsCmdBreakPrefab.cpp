@@ -17,11 +17,10 @@ namespace bs
 	void CmdBreakPrefab::execute(const HSceneObject& sceneObject, const String& description)
 	{
 		// Register command and commit it
-		CmdBreakPrefab* command = new (bs_alloc<CmdBreakPrefab>()) CmdBreakPrefab(description, sceneObject);
-		SPtr<CmdBreakPrefab> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdBreakPrefab> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdBreakPrefab>(
+			description, sceneObject);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 	}
 
 	void CmdBreakPrefab::commit()
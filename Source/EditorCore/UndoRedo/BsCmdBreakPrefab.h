@@ -33,8 +33,12 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getTypeName */
+		String getTypeName() const override { return "CmdBreakPrefab"; }
+
 	private:
 		friend class UndoRedo;
+		friend class UndoRedoArena;
 
 		CmdBreakPrefab(const String& description, const HSceneObject& sceneObject);
 
@@ -12,11 +12,10 @@ namespace bs
 	HSceneObject CmdCloneSO::execute(const HSceneObject& sceneObject, const String& description)
 	{
 		// Register command and commit it
-		CmdCloneSO* command = new (bs_alloc<CmdCloneSO>()) CmdCloneSO(description, { sceneObject });
-		SPtr<CmdCloneSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdCloneSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdCloneSO>(
+			description, Vector<HSceneObject>{ sceneObject });
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 
 		if (!commandPtr->mClones.empty())
 			return commandPtr->mClones[0];
@@ -27,11 +26,10 @@ namespace bs
 	Vector<HSceneObject> CmdCloneSO::execute(const Vector<HSceneObject>& sceneObjects, const String& description)
 	{
 		// Register command and commit it
-		CmdCloneSO* command = new (bs_alloc<CmdCloneSO>()) CmdCloneSO(description, sceneObjects);
-		SPtr<CmdCloneSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdCloneSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdCloneSO>(
+			description, sceneObjects);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 
 		return commandPtr->mClones;
 	}
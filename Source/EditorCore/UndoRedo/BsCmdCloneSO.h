@@ -42,8 +42,12 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getTypeName */
+		String getTypeName() const override { return "CmdCloneSO"; }
+
 	private:
 		friend class UndoRedo;
+		friend class UndoRedoArena;
 
 		CmdCloneSO(const String& description, const Vector<HSceneObject>& originals);
 
@@ -18,11 +18,10 @@ namespace bs
 	HSceneObject CmdCreateSO::execute(const String& name, UINT32 flags, const String& description)
 	{
 		// Register command and commit it
-		CmdCreateSO* command = new (bs_alloc<CmdCreateSO>()) CmdCreateSO(description, name, flags);
-		SPtr<CmdCreateSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdCreateSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdCreateSO>(
+			description, name, flags);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 
 		return commandPtr->mSceneObject;
 	}
@@ -31,11 +30,10 @@ namespace bs
 		const String& description)
 	{
 		// Register command and commit it
-		CmdCreateSO* command = new (bs_alloc<CmdCreateSO>()) CmdCreateSO(description, name, componentTypeIds, flags);
-		SPtr<CmdCreateSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdCreateSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdCreateSO>(
+			description, name, componentTypeIds, flags);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 
 		return commandPtr->mSceneObject;
 	}
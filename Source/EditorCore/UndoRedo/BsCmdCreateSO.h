@@ -45,8 +45,12 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getTypeName */
+		String getTypeName() const override { return "CmdCreateSO"; }
+
 	private:
 		friend class UndoRedo;
+		friend class UndoRedoArena;
 
 		CmdCreateSO(const String& description, const String& name, UINT32 flags);
 		CmdCreateSO(const String& description, const String& name, const Vector<UINT32>& componentTypeIds, UINT32 flags);
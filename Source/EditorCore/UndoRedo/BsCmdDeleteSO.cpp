@@ -4,39 +4,117 @@
 #include "UndoRedo/BsUndoRedo.h"
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsSerializedSceneObject.h"
-#include "Serialization/BsMemorySerializer.h"
 #include "Scene/BsSelection.h"
 
 namespace bs
 {
-	CmdDeleteSO::CmdDeleteSO(const String& description, const HSceneObject& sceneObject)
-		: EditorCommand(description), mSceneObject(sceneObject)
+	CmdDeleteSO::CmdDeleteSO(const String& description, const Vector<HSceneObject>& sceneObjects)
+		: EditorCommand(description), mSceneObjects(sceneObjects)
 	{ }
 
 	void CmdDeleteSO::execute(const HSceneObject& sceneObject, const String& description)
 	{
 		// Register command and commit it
-		CmdDeleteSO* command = new (bs_alloc<CmdDeleteSO>()) CmdDeleteSO(description, sceneObject);
-		SPtr<CmdDeleteSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdDeleteSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdDeleteSO>(
+			description, Vector<HSceneObject>{ sceneObject });
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
+	}
+
+	void CmdDeleteSO::execute(const Vector<HSceneObject>& sceneObjects, const String& description)
+	{
+		UnorderedSet<UINT64> deletedIds;
+		for (auto& sceneObject : sceneObjects)
+		{
+			if (!sceneObject.isDestroyed())
+				deletedIds.insert(sceneObject->getInstanceId());
+		}
+
+		// Children get deleted and restored as part of their parent's hierarchy
+		Vector<HSceneObject> roots;
+		for (auto& sceneObject : sceneObjects)
+		{
+			if (sceneObject.isDestroyed())
+				continue;
+
+			bool hasDeletedParent = false;
+			HSceneObject parent = sceneObject->getParent();
+			while (parent != nullptr)
+			{
+				if (deletedIds.find(parent->getInstanceId()) != deletedIds.end())
+				{
+					hasDeletedParent = true;
+					break;
+				}
+
+				parent = parent->getParent();
+			}
+
+			if (!hasDeletedParent)
+				roots.push_back(sceneObject);
+		}
+
+		// Register command and commit it
+		SPtr<CmdDeleteSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdDeleteSO>(description, roots);
+
+		UndoRedo::instance().registerCommand(commandPtr, true);
 	}
 
 	void CmdDeleteSO::commit()
 	{
-		if (mSceneObject == nullptr || mSceneObject.isDestroyed())
-			return;
+		mSerialized.clear();
+
+		// Each root is recorded in place, with its own parent, so the hierarchy doesn't need to be modified before the
+		// objects are deleted. Roots are never ancestors of one another, so they can be recorded independently.
+		for (auto& sceneObject : mSceneObjects)
+		{
+			if (sceneObject == nullptr || sceneObject.isDestroyed())
+				continue;
+
+			mSerialized.push_back(UndoRedo::instance().getActiveArena().newShared<SerializedSceneObject>(
+				sceneObject, true));
+		}
 
-		mSerialized = bs_shared_ptr_new<SerializedSceneObject>(mSceneObject, true);
-		mSceneObject->destroy();
+		for (auto& serialized : mSerialized)
+			serialized->getSceneObject()->destroy();
 	}
 
 	void CmdDeleteSO::revert()
 	{
-		mSerialized->restore();
+		if (mSerialized.empty())
+			return;
+
+		Vector<HSceneObject> restored;
+		restored.reserve(mSerialized.size());
+
+		for (auto& serialized : mSerialized)
+		{
+			serialized->restore();
+
+			const HSceneObject& sceneObject = serialized->getSceneObject();
+			if (!sceneObject.isDestroyed(true))
+				restored.push_back(sceneObject);
+		}
+
+		if (!restored.empty())
+			Selection::instance().setSceneObjects(restored);
+	}
 
-		if(!mSceneObject.isDestroyed(true))
-			Selection::instance().setSceneObjects({ mSceneObject });
+	UINT64 CmdDeleteSO::getMemoryUsage() const
+	{
+		UINT64 usage = EditorCommand::getMemoryUsage();
+		usage += mSceneObjects.size() * sizeof(HSceneObject);
+		usage += mSerialized.size() * sizeof(SPtr<SerializedSceneObject>);
+
+		for (auto& serialized : mSerialized)
+			usage += serialized->getMemoryUsage();
+
+		return usage;
+	}
+
+	void CmdDeleteSO::onCommandCold(bool spillToDisk)
+	{
+		for (auto& serialized : mSerialized)
+			serialized->compress(spillToDisk);
 	}
 }
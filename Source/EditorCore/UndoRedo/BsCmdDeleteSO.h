@@ -14,7 +14,7 @@ namespace bs
 	 *  @{
 	 */
 
-	/** A command used for undo/redo purposes. Deletes a scene object and restores it as an undo operation. */
+	/** A command used for undo/redo purposes. Deletes scene object(s) and restores them as an undo operation. */
 	class BS_ED_EXPORT CmdDeleteSO final : public EditorCommand
 	{
 	public:
@@ -27,19 +27,39 @@ namespace bs
 		 */
 		static void execute(const HSceneObject& sceneObject, const String& description = StringUtil::BLANK);
 
+		/**
+		 * Creates and executes the command on the provided scene objects. All objects are deleted and restored together,
+		 * as a single command. Automatically registers the command with undo/redo system.
+		 *
+		 * @param[in]	sceneObjects	Scene objects to delete. Objects whose ancestor is also in the list are ignored, as
+		 *								they get deleted along with the ancestor.
+		 * @param[in]	description		Optional description of what exactly the command does.
+		 */
+		static void execute(const Vector<HSceneObject>& sceneObjects, const String& description = StringUtil::BLANK);
+
 		/** @copydoc EditorCommand::commit */
 		void commit() override;
 
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getMemoryUsage */
+		UINT64 getMemoryUsage() const override;
+
+		/** @copydoc EditorCommand::getTypeName */
+		String getTypeName() const override { return "CmdDeleteSO"; }
+
 	private:
 		friend class UndoRedo;
+		friend class UndoRedoArena;
+
+		CmdDeleteSO(const String& description, const Vector<HSceneObject>& sceneObjects);
 
-		CmdDeleteSO(const String& description, const HSceneObject& sceneObject);
+		/** @copydoc EditorCommand::onCommandCold */
+		void onCommandCold(bool spillToDisk) override;
 
-		HSceneObject mSceneObject;
-		SPtr<SerializedSceneObject> mSerialized;
+		Vector<HSceneObject> mSceneObjects;
+		Vector<SPtr<SerializedSceneObject>> mSerialized;
 	};
 
 	/** @} */
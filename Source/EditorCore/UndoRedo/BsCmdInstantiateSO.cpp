@@ -13,11 +13,10 @@ namespace bs
 	HSceneObject CmdInstantiateSO::execute(const HPrefab& prefab, const String& description)
 	{
 		// Register command and commit it
-		CmdInstantiateSO* command = new (bs_alloc<CmdInstantiateSO>()) CmdInstantiateSO(description, prefab);
-		SPtr<CmdInstantiateSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdInstantiateSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdInstantiateSO>(
+			description, prefab);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 
 		return commandPtr->mSceneObject;
 	}
@@ -34,8 +34,12 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getTypeName */
+		String getTypeName() const override { return "CmdInstantiateSO"; }
+
 	private:
 		friend class UndoRedo;
+		friend class UndoRedoArena;
 
 		CmdInstantiateSO(const String& description, const HPrefab& prefab);
 
@@ -19,12 +19,10 @@ namespace bs
 			oldName = sceneObject->getName();
 
 		// Register command and commit it
-		CmdRenameSO* command = new (bs_alloc<CmdRenameSO>()) 
-			CmdRenameSO(StringUtil::format("Rename scene object '{0}' to '{1}'", oldName, newName), sceneObject, newName);
-		SPtr<CmdRenameSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdRenameSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdRenameSO>(
+			StringUtil::format("Rename scene object '{0}' to '{1}'", oldName, newName), sceneObject, newName);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 	}
 
 	void CmdRenameSO::commit()
@@ -34,8 +34,12 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getTypeName */
+		String getTypeName() const override { return "CmdRenameSO"; }
+
 	private:
 		friend class UndoRedo;
+		friend class UndoRedoArena;
 
 		CmdRenameSO(const String& description, const HSceneObject& sceneObject, const String& newName);
 
@@ -18,21 +18,19 @@ namespace bs
 		const String& description)
 	{
 		// Register command and commit it
-		CmdReparentSO* command = new (bs_alloc<CmdReparentSO>()) CmdReparentSO(description, sceneObjects, newParent);
-		SPtr<CmdReparentSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdReparentSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdReparentSO>(
+			description, sceneObjects, newParent);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 	}
 
 	void CmdReparentSO::execute(HSceneObject& sceneObject, const HSceneObject& newParent, const String& description)
 	{
 		// Register command and commit it
-		CmdReparentSO* command = new (bs_alloc<CmdReparentSO>()) CmdReparentSO(description, { sceneObject }, newParent);
-		SPtr<CmdReparentSO> commandPtr = bs_shared_ptr(command);
+		SPtr<CmdReparentSO> commandPtr = UndoRedo::instance().getActiveArena().newShared<CmdReparentSO>(
+			description, Vector<HSceneObject>{ sceneObject }, newParent);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		UndoRedo::instance().registerCommand(commandPtr, true);
 	}
 
 	void CmdReparentSO::commit()
@@ -1,10 +1,11 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsEditorCommand.h"
+#include "Utility/BsTime.h"
 
 namespace bs
 {
 	EditorCommand::EditorCommand(const String& description)
-		:mDescription(description), mId(0)
+		:mDescription(description), mId(0), mCreationTime(gTime().getTimePrecise())
 	{ }
 }
\ No newline at end of file
@@ -26,6 +26,18 @@ namespace bs
 		/** Reverts the command, reverting the change previously done with commit(). */
 		virtual void revert() { }
 
+		/** 
+		 * Returns an estimate of the memory used by the command, in bytes. Used by the undo/redo stack for enforcing its
+		 * memory budget. Commands holding large amounts of data should override this.
+		 */
+		virtual UINT64 getMemoryUsage() const { return sizeof(EditorCommand) + mDescription.size(); }
+
+		/** Returns a name identifying the type of the command, used for profiling. */
+		virtual String getTypeName() const { return "EditorCommand"; }
+
+		/** Returns the description the command was created with. */
+		const String& getDescription() const { return mDescription; }
+
 	private:
 		friend class UndoRedo;
 
@@ -35,8 +47,25 @@ namespace bs
 		/** Triggers when a command is removed from an undo/redo stack. */
 		virtual void onCommandRemoved() {}
 
+		/** 
+		 * Triggers when a command moves far enough down the undo stack that it is unlikely to be executed soon. Commands
+		 * holding large amounts of data may use this opportunity to compress it, and decompress it once executed.
+		 *
+		 * @param[in]	spillToDisk		True if the command is allowed to move its data from memory into a temporary file.
+		 */
+		virtual void onCommandCold(bool spillToDisk) { }
+
 		String mDescription;
 		UINT32 mId;
+
+		UINT64 mCreationTime;
+		float mLastCommitTime = 0.0f;
+		float mLastRevertTime = 0.0f;
+		UINT32 mNumCommits = 0;
+		UINT32 mNumReverts = 0;
+
+		/** Memory usage of the command as last accounted for in the running total of the undo/redo stack. */
+		UINT64 mTrackedMemoryUsage = 0;
 	};
 
 	/** @} */
@@ -2,17 +2,21 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsUndoRedo.h"
 #include "UndoRedo/BsEditorCommand.h"
+#include "Utility/BsTime.h"
 
 namespace bs
 {
 	const UINT32 UndoRedo::MAX_STACK_ELEMENTS = 1000;
+	const UINT32 UndoRedo::COLD_COMMAND_DEPTH = 8;
+	UndoRedo* UndoRedo::mOverride = nullptr;
 
 	UndoRedo::UndoRedo()
 		: mUndoStack(nullptr), mRedoStack(nullptr), mUndoStackPtr(0), mUndoNumElements(0), mRedoStackPtr(0)
-		, mRedoNumElements(0), mNextCommandId(0)
+		, mRedoNumElements(0), mNextCommandId(1)
 	{
 		mUndoStack = bs_newN<SPtr<EditorCommand>>(MAX_STACK_ELEMENTS);
 		mRedoStack = bs_newN<SPtr<EditorCommand>>(MAX_STACK_ELEMENTS);
+		mArena = bs_shared_ptr_new<UndoRedoArena>();
 	}
 
 	UndoRedo::~UndoRedo()
@@ -36,7 +40,16 @@ namespace bs
 		mRedoStack[mRedoStackPtr] = command;
 		mRedoNumElements = std::min(mRedoNumElements + 1, MAX_STACK_ELEMENTS);
 
+		UINT64 startTime = gTime().getTimePrecise();
 		command->revert();
+
+		command->mLastRevertTime = (gTime().getTimePrecise() - startTime) / 1000.0f;
+		command->mNumReverts++;
+
+		// Executing the command might have decompressed its data
+		updateMemoryUsage(*command);
+
+		onStackChanged();
 	}
 
 	void UndoRedo::redo()
@@ -51,7 +64,16 @@ namespace bs
 
 		addToUndoStack(command);
 
+		UINT64 startTime = gTime().getTimePrecise();
 		command->commit();
+
+		command->mLastCommitTime = (gTime().getTimePrecise() - startTime) / 1000.0f;
+		command->mNumCommits++;
+
+		updateMemoryUsage(*command);
+		markColdCommand();
+
+		onStackChanged();
 	}
 
 	void UndoRedo::pushGroup(const String& name)
@@ -61,6 +83,7 @@ namespace bs
 
 		newGroup.name = name;
 		newGroup.numEntries = 0;
+		newGroup.arena = bs_shared_ptr_new<UndoRedoArena>();
 
 		clearRedoStack();
 	}
@@ -77,7 +100,10 @@ namespace bs
 		for(UINT32 i = 0; i < topGroup.numEntries; i++)
 		{
 			if (mUndoStack[mUndoStackPtr] != nullptr)
+			{
+				untrackMemoryUsage(*mUndoStack[mUndoStackPtr]);
 				mUndoStack[mUndoStackPtr]->onCommandRemoved();
+			}
 
 			mUndoStack[mUndoStackPtr] = SPtr<EditorCommand>();
 			mUndoStackPtr = (mUndoStackPtr - 1) % MAX_STACK_ELEMENTS;
@@ -86,18 +112,43 @@ namespace bs
 
 		mGroups.pop_back();
 		clearRedoStack();
+
+		onStackChanged();
 	}
 
-	void UndoRedo::registerCommand(const SPtr<EditorCommand>& command)
+	void UndoRedo::registerCommand(const SPtr<EditorCommand>& command, bool commit)
 	{
+		// Zero is reserved for an empty stack
 		command->mId = mNextCommandId++;
+		if (mNextCommandId == 0)
+			mNextCommandId = 1;
+
 		command->onCommandAdded();
 
 		SPtr<EditorCommand> existingCommand = addToUndoStack(command);
 		if (existingCommand != nullptr)
+		{
+			untrackMemoryUsage(*existingCommand);
 			existingCommand->onCommandRemoved();
+		}
 
 		clearRedoStack();
+
+		if (commit)
+		{
+			UINT64 startTime = gTime().getTimePrecise();
+			command->commit();
+
+			command->mLastCommitTime = (gTime().getTimePrecise() - startTime) / 1000.0f;
+			command->mNumCommits++;
+		}
+
+		trackMemoryUsage(*command);
+		markColdCommand();
+
+		enforceMemoryBudget();
+
+		onStackChanged();
 	}
 
 	UINT32 UndoRedo::getTopCommandId() const
@@ -116,7 +167,10 @@ namespace bs
 			if (mUndoStack[undoPtr]->mId == id)
 			{
 				if (mUndoStack[undoPtr] != nullptr)
+				{
+					untrackMemoryUsage(*mUndoStack[undoPtr]);
 					mUndoStack[undoPtr]->onCommandRemoved();
+				}
 
 				mUndoStack[undoPtr] = SPtr<EditorCommand>();
 
@@ -130,6 +184,21 @@ namespace bs
 
 				mUndoStackPtr = (mUndoStackPtr - 1) % MAX_STACK_ELEMENTS;
 				mUndoNumElements--;
+
+				// Remove the command from the group it was registered in, so popping the group doesn't remove more
+				// commands than it contains
+				UINT32 depth = i;
+				for (auto iter = mGroups.rbegin(); iter != mGroups.rend(); ++iter)
+				{
+					if (depth < iter->numEntries)
+					{
+						iter->numEntries--;
+						break;
+					}
+
+					depth -= iter->numEntries;
+				}
+
 				break;
 			}
 
@@ -142,7 +211,10 @@ namespace bs
 			if (mRedoStack[redoPtr]->mId == id)
 			{
 				if (mRedoStack[redoPtr] != nullptr)
+				{
+					untrackMemoryUsage(*mRedoStack[redoPtr]);
 					mRedoStack[redoPtr]->onCommandRemoved();
+				}
 
 				mRedoStack[redoPtr] = SPtr<EditorCommand>();
 
@@ -161,12 +233,90 @@ namespace bs
 
 			redoPtr = (redoPtr - 1) % MAX_STACK_ELEMENTS;
 		}
+
+		onStackChanged();
 	}
 
 	void UndoRedo::clear()
 	{
 		clearUndoStack();
 		clearRedoStack();
+
+		onStackChanged();
+	}
+
+	void UndoRedo::setMemoryBudget(UINT64 budget)
+	{
+		mMemoryBudget = budget;
+		enforceMemoryBudget();
+	}
+
+	Vector<UndoRedoCommandInfo> UndoRedo::getCommandInfo() const
+	{
+		auto toInfo = [](const EditorCommand& command, bool isRedo)
+		{
+			UndoRedoCommandInfo info;
+			info.id = command.mId;
+			info.type = command.getTypeName();
+			info.description = command.mDescription;
+			info.memoryUsage = command.getMemoryUsage();
+			info.creationTime = command.mCreationTime;
+			info.lastCommitTime = command.mLastCommitTime;
+			info.lastRevertTime = command.mLastRevertTime;
+			info.numCommits = command.mNumCommits;
+			info.numReverts = command.mNumReverts;
+			info.isRedo = isRedo;
+
+			return info;
+		};
+
+		Vector<UndoRedoCommandInfo> output;
+		output.reserve(mUndoNumElements + mRedoNumElements);
+
+		for (UINT32 i = 0; i < mUndoNumElements; i++)
+		{
+			UINT32 undoPtr = (mUndoStackPtr + MAX_STACK_ELEMENTS - i) % MAX_STACK_ELEMENTS;
+			if (mUndoStack[undoPtr] != nullptr)
+				output.push_back(toInfo(*mUndoStack[undoPtr], false));
+		}
+
+		for (UINT32 i = 0; i < mRedoNumElements; i++)
+		{
+			UINT32 redoPtr = (mRedoStackPtr + MAX_STACK_ELEMENTS - i) % MAX_STACK_ELEMENTS;
+			if (mRedoStack[redoPtr] != nullptr)
+				output.push_back(toInfo(*mRedoStack[redoPtr], true));
+		}
+
+		return output;
+	}
+
+	UndoRedo& UndoRedo::instance()
+	{
+		if (mOverride != nullptr)
+			return *mOverride;
+
+		return Module<UndoRedo>::instance();
+	}
+
+	UndoRedo* UndoRedo::instancePtr()
+	{
+		if (mOverride != nullptr)
+			return mOverride;
+
+		return Module<UndoRedo>::instancePtr();
+	}
+
+	void UndoRedo::_setOverride(UndoRedo* undoRedo)
+	{
+		mOverride = undoRedo;
+	}
+
+	UndoRedoArena& UndoRedo::getActiveArena()
+	{
+		if (!mGroups.empty())
+			return *mGroups.back().arena;
+
+		return *mArena;
 	}
 
 	SPtr<EditorCommand> UndoRedo::removeLastFromUndoStack()
@@ -214,7 +364,10 @@ namespace bs
 		while(mUndoNumElements > 0)
 		{
 			if (mUndoStack[mUndoStackPtr] != nullptr)
+			{
+				untrackMemoryUsage(*mUndoStack[mUndoStackPtr]);
 				mUndoStack[mUndoStackPtr]->onCommandRemoved();
+			}
 
 			mUndoStack[mUndoStackPtr] = SPtr<EditorCommand>();
 			mUndoStackPtr = (mUndoStackPtr - 1) % MAX_STACK_ELEMENTS;
@@ -224,12 +377,97 @@ namespace bs
 		mGroups.clear();
 	}
 
+	void UndoRedo::enforceMemoryBudget()
+	{
+		if (mMemoryBudget == 0)
+			return;
+
+		UINT32 numGrouped = 0;
+		for (auto& group : mGroups)
+			numGrouped += group.numEntries;
+
+		UINT32 numUngrouped = mUndoNumElements - std::min(numGrouped, mUndoNumElements);
+		UINT32 numEvicted = 0;
+
+		while (mMemoryUsage > mMemoryBudget && mUndoNumElements > 1)
+		{
+			UINT32 oldestPtr = (mUndoStackPtr + MAX_STACK_ELEMENTS - (mUndoNumElements - 1)) % MAX_STACK_ELEMENTS;
+
+			SPtr<EditorCommand> command = mUndoStack[oldestPtr];
+			mUndoStack[oldestPtr] = SPtr<EditorCommand>();
+			mUndoNumElements--;
+			numEvicted++;
+
+			if (command != nullptr)
+			{
+				untrackMemoryUsage(*command);
+				command->onCommandRemoved();
+			}
+		}
+
+		// Oldest commands are the ones registered outside of any group, followed by the commands of the outermost
+		// group and then the groups nested in it (the opposite end from removeLastFromUndoStack())
+		UINT32 numToRemove = numEvicted - std::min(numEvicted, numUngrouped);
+		for (auto& group : mGroups)
+		{
+			if (numToRemove == 0)
+				break;
+
+			UINT32 numRemoved = std::min(numToRemove, group.numEntries);
+			group.numEntries -= numRemoved;
+			numToRemove -= numRemoved;
+		}
+	}
+
+	void UndoRedo::markColdCommand()
+	{
+		if (mUndoNumElements <= COLD_COMMAND_DEPTH)
+			return;
+
+		// Let the command that just moved past the cold depth compress its data
+		UINT32 coldPtr = (mUndoStackPtr + MAX_STACK_ELEMENTS - COLD_COMMAND_DEPTH) % MAX_STACK_ELEMENTS;
+		if (mUndoStack[coldPtr] != nullptr)
+		{
+			mUndoStack[coldPtr]->onCommandCold(mSpillToDisk);
+			updateMemoryUsage(*mUndoStack[coldPtr]);
+		}
+
+		// Compression runs in the background, so pick up the result for the command that went cold before this one
+		if (mUndoNumElements > COLD_COMMAND_DEPTH + 1)
+		{
+			UINT32 prevColdPtr = (coldPtr + MAX_STACK_ELEMENTS - 1) % MAX_STACK_ELEMENTS;
+			if (mUndoStack[prevColdPtr] != nullptr)
+				updateMemoryUsage(*mUndoStack[prevColdPtr]);
+		}
+	}
+
+	void UndoRedo::trackMemoryUsage(EditorCommand& command)
+	{
+		command.mTrackedMemoryUsage = command.getMemoryUsage();
+		mMemoryUsage += command.mTrackedMemoryUsage;
+	}
+
+	void UndoRedo::untrackMemoryUsage(EditorCommand& command)
+	{
+		mMemoryUsage -= std::min(mMemoryUsage, command.mTrackedMemoryUsage);
+		command.mTrackedMemoryUsage = 0;
+	}
+
+	void UndoRedo::updateMemoryUsage(EditorCommand& command)
+	{
+		untrackMemoryUsage(command);
+		trackMemoryUsage(command);
+	}
+
 	void UndoRedo::clearRedoStack()
 	{
 		while(mRedoNumElements > 0)
 		{
 			if (mRedoStack[mRedoStackPtr] != nullptr)
+			{
+				untrackMemoryUsage(*mRedoStack[mRedoStackPtr]);
 				mRedoStack[mRedoStackPtr]->onCommandRemoved();
+			}
 
 			mRedoStack[mRedoStackPtr] = SPtr<EditorCommand>();
 			mRedoStackPtr = (mRedoStackPtr - 1) % MAX_STACK_ELEMENTS;
@@ -4,6 +4,8 @@
 
 #include "BsEditorPrerequisites.h"
 #include "Utility/BsModule.h"
+#include "Utility/BsEvent.h"
+#include "UndoRedo/BsUndoRedoArena.h"
 
 namespace bs
 {
@@ -11,6 +13,43 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Information about a single command in the undo/redo stacks, used for profiling. */
+	struct UndoRedoCommandInfo
+	{
+		/** Unique identifier of the command, as accepted by UndoRedo::popCommand(). */
+		UINT32 id = 0;
+
+		/** Name of the command type. */
+		String type;
+
+		/** Description provided when the command was created. */
+		String description;
+
+		/** Estimate of the memory used by the command, in bytes. */
+		UINT64 memoryUsage = 0;
+
+		/** Time at which the command was created, in microseconds since application start. */
+		UINT64 creationTime = 0;
+
+		/** 
+		 * Duration of the last commit(), in milliseconds. Includes the initial commit performed by registerCommand(), if
+		 * requested. Zero if never committed by the stack.
+		 */
+		float lastCommitTime = 0.0f;
+
+		/** Duration of the last revert() executed through undo, in milliseconds. Zero if never undone. */
+		float lastRevertTime = 0.0f;
+
+		/** Number of times the command was committed by the stack, either by registerCommand() or through redo. */
+		UINT32 numCommits = 0;
+
+		/** Number of times the command was undone. */
+		UINT32 numReverts = 0;
+
+		/** True if the command is on the redo stack, false if it is on the undo stack. */
+		bool isRedo = false;
+	};
+
 	/**	Provides functionality to undo or redo recently performed operations in the editor. */
 	class BS_ED_EXPORT UndoRedo : public Module<UndoRedo>
 	{
@@ -21,6 +60,7 @@ namespace bs
 		{
 			String name;
 			UINT32 numEntries;
+			SPtr<UndoRedoArena> arena;
 		};
 
 	public:
@@ -52,10 +92,20 @@ namespace bs
 		 */
 		void popGroup(const String& name);
 
-		/**	Registers a new undo command. */
-		void registerCommand(const SPtr<EditorCommand>& command);
+		/**
+		 * Registers a new undo command.
+		 *
+		 * @param[in]	command		Command to register.
+		 * @param[in]	commit		If true the command will be committed right after it is registered, and the duration of
+		 *							the commit will be recorded. Otherwise the caller is expected to have applied the change
+		 *							on its own.
+		 */
+		void registerCommand(const SPtr<EditorCommand>& command, bool commit = false);
 
-		/**	Returns the unique identifier for the command on top of the undo stack. */
+		/**
+		 * Returns the unique identifier for the command on top of the undo stack, or zero if the undo stack is empty.
+		 * Commands are never assigned a zero identifier.
+		 */
 		UINT32 getTopCommandId() const;
 
 		/**
@@ -68,6 +118,69 @@ namespace bs
 		/**	Resets the undo/redo stacks. */
 		void clear();
 
+		/**
+		 * Sets the maximum amount of memory the commands in the undo/redo stacks are allowed to use, in bytes. When the
+		 * budget is exceeded the oldest undo commands are discarded, but the most recent command is always kept. Zero 
+		 * means no limit.
+		 */
+		void setMemoryBudget(UINT64 budget);
+
+		/** @copydoc setMemoryBudget */
+		UINT64 getMemoryBudget() const { return mMemoryBudget; }
+
+		/** 
+		 * Determines if commands that move far enough down the undo stack can move their data into temporary files, 
+		 * in addition to compressing it.
+		 */
+		void setSpillToDisk(bool spill) { mSpillToDisk = spill; }
+
+		/** @copydoc setSpillToDisk */
+		bool getSpillToDisk() const { return mSpillToDisk; }
+
+		/** 
+		 * Returns the memory used by all the commands in the undo and redo stacks, in bytes. This is a running total, 
+		 * updated whenever a command is added, removed, executed or made cold, rather than recalculated on each call.
+		 */
+		UINT64 getMemoryUsage() const { return mMemoryUsage; }
+
+		/** 
+		 * Returns information about all the commands in the undo/redo stacks. Undo stack commands are returned first,
+		 * starting with the most recent one, followed by the redo stack commands, starting with the next one to be redone.
+		 */
+		Vector<UndoRedoCommandInfo> getCommandInfo() const;
+
+		/** 
+		 * Returns the arena new commands should be allocated from. Each group has its own arena, so the memory of its
+		 * commands is released together once the group is popped.
+		 */
+		UndoRedoArena& getActiveArena();
+
+		/** Triggered whenever commands are added to, removed from or moved between the undo and redo stacks. */
+		Event<void()> onStackChanged;
+
+		/** 
+		 * Returns the stack that commands are currently registered with. Normally this is the editor-wide stack, unless
+		 * it was overridden by calling _setOverride().
+		 */
+		static UndoRedo& instance();
+
+		/** @copydoc instance */
+		static UndoRedo* instancePtr();
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Makes instance() return the provided stack instead of the editor-wide one, until called again with null.
+		 * Allows tests and benchmarks to execute commands without affecting the user's undo history.
+		 *
+		 * @note	Internal method.
+		 */
+		static void _setOverride(UndoRedo* undoRedo);
+
+		/** @} */
+
 	private:
 		/**	Removes the last undo command from the undo stack, and returns it. */
 		SPtr<EditorCommand> removeLastFromUndoStack();
@@ -81,8 +194,29 @@ namespace bs
 		/**	Removes all entries from the redo stack. */
 		void clearRedoStack();
 
+		/** Removes the oldest commands from the undo stack until the memory usage fits within the memory budget. */
+		void enforceMemoryBudget();
+
+		/** 
+		 * Notifies the command that just moved past the cold depth of the undo stack that it became cold. Should be 
+		 * called whenever a command is pushed on top of the undo stack.
+		 */
+		void markColdCommand();
+
+		/** Adds the current memory usage of the command to the running total. */
+		void trackMemoryUsage(EditorCommand& command);
+
+		/** Removes the memory usage of the command from the running total. */
+		void untrackMemoryUsage(EditorCommand& command);
+
+		/** Updates the running total with the command's current memory usage, if it changed since it was tracked. */
+		void updateMemoryUsage(EditorCommand& command);
+
 		static const UINT32 MAX_STACK_ELEMENTS;
 
+		/** Number of commands above a command on the undo stack, after which the command is considered cold. */
+		static const UINT32 COLD_COMMAND_DEPTH;
+
 		SPtr<EditorCommand>* mUndoStack;
 		SPtr<EditorCommand>* mRedoStack;
 
@@ -95,6 +229,13 @@ namespace bs
 		UINT32 mNextCommandId;
 
 		Vector<GroupData> mGroups;
+		SPtr<UndoRedoArena> mArena;
+
+		UINT64 mMemoryUsage = 0;
+		UINT64 mMemoryBudget = 512 * 1024 * 1024;
+		bool mSpillToDisk = false;
+
+		static UndoRedo* mOverride;
 	};
 
 	/** @} */
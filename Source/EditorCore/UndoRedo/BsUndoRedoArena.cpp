@@ -0,0 +1,129 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "UndoRedo/BsUndoRedoArena.h"
+
+namespace bs
+{
+	/** Alignment of all the allocations made from an arena. */
+	static constexpr UINT32 ARENA_ALIGNMENT = 16;
+
+	/** 
+	 * Size of the header in front of every allocation, containing a pointer to the owning chunk. Padded so the
+	 * allocations stay aligned. 
+	 */
+	static constexpr UINT32 ALLOCATION_HEADER_SIZE = ARENA_ALIGNMENT;
+
+	/** Rounds the provided size up to the arena alignment. */
+	static constexpr UINT32 alignSize(UINT32 size)
+	{
+		return (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+	}
+
+	UndoRedoArena::UndoRedoArena(UINT32 chunkSize)
+		:mChunkSize(alignSize(chunkSize))
+	{ }
+
+	UndoRedoArena::~UndoRedoArena()
+	{
+		// Chunks with live allocations are released once the last of their allocations is freed
+		for (auto& chunk : mChunks)
+		{
+			if (chunk->numAllocations == 0)
+				bs_free(chunk);
+			else
+				chunk->owner = nullptr;
+		}
+	}
+
+	void* UndoRedoArena::allocate(size_t size)
+	{
+		// Chunk sizes are 32-bit, and the chunk header must fit alongside the allocation
+		assert(size <= std::numeric_limits<UINT32>::max() - alignSize(sizeof(Chunk)) - ALLOCATION_HEADER_SIZE -
+			ARENA_ALIGNMENT);
+
+		UINT32 allocationSize = alignSize((UINT32)size) + ALLOCATION_HEADER_SIZE;
+
+		Chunk* chunk;
+		if (allocationSize > mChunkSize / 2)
+			chunk = allocateChunk(allocationSize);
+		else
+		{
+			if (mCurrentChunk == nullptr || (mCurrentChunk->used + allocationSize) > mCurrentChunk->size)
+			{
+				// The old chunk gets released once its allocations are freed
+				if (mSpareChunk != nullptr)
+				{
+					mCurrentChunk = mSpareChunk;
+					mSpareChunk = nullptr;
+				}
+				else
+					mCurrentChunk = allocateChunk(mChunkSize);
+			}
+
+			chunk = mCurrentChunk;
+		}
+
+		UINT8* data = (UINT8*)chunk + alignSize(sizeof(Chunk)) + chunk->used;
+		*(Chunk**)data = chunk;
+
+		chunk->used += allocationSize;
+		chunk->numAllocations++;
+		mNumAllocations++;
+
+		return data + ALLOCATION_HEADER_SIZE;
+	}
+
+	void UndoRedoArena::free(void* data)
+	{
+		if (data == nullptr)
+			return;
+
+		Chunk* chunk = *(Chunk**)((UINT8*)data - ALLOCATION_HEADER_SIZE);
+
+		assert(chunk->numAllocations > 0);
+		chunk->numAllocations--;
+
+		if (chunk->numAllocations > 0)
+			return;
+
+		if (chunk->owner != nullptr)
+			chunk->owner->onChunkEmpty(chunk);
+		else
+			bs_free(chunk);
+	}
+
+	UndoRedoArena::Chunk* UndoRedoArena::allocateChunk(UINT32 size)
+	{
+		Chunk* chunk = (Chunk*)bs_alloc(alignSize(sizeof(Chunk)) + size);
+		chunk->owner = this;
+		chunk->size = size;
+		chunk->used = 0;
+		chunk->numAllocations = 0;
+
+		mChunks.insert(chunk);
+		mNumChunkAllocations++;
+		mMemoryUsage += size;
+
+		return chunk;
+	}
+
+	void UndoRedoArena::onChunkEmpty(Chunk* chunk)
+	{
+		chunk->used = 0;
+
+		// Keep the active chunk, and a single spare one, so a command being repeatedly added and removed doesn't cause
+		// a chunk allocation every time
+		if (chunk == mCurrentChunk)
+			return;
+
+		if (mSpareChunk == nullptr && chunk->size == mChunkSize)
+		{
+			mSpareChunk = chunk;
+			return;
+		}
+
+		mChunks.erase(chunk);
+		mMemoryUsage -= chunk->size;
+		bs_free(chunk);
+	}
+}
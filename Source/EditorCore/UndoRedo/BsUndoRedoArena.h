@@ -0,0 +1,148 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup UndoRedo
+	 *  @{
+	 */
+
+	/**
+	 * Allocator used for undo/redo commands and the small objects they own. Allocations are made from large chunks,
+	 * avoiding a separate system allocation for every command. Individual allocations are never reused, instead a chunk
+	 * is released as a whole once all of its allocations are freed. Since commands are mostly added and removed from the
+	 * undo/redo stack in order, this releases memory in bulk when commands fall off the stack or the redo stack is
+	 * cleared.
+	 *
+	 * Large payloads, such as serialized scene object data, are not allocated from the arena. They may be shared between
+	 * commands from different groups, and are compressed and freed on worker threads.
+	 *
+	 * Allocations are allowed to outlive the arena they were made from, in which case their chunk is released when the
+	 * last allocation is freed.
+	 *
+	 * @note	Not thread safe. Memory must be allocated and freed on the main thread.
+	 */
+	class BS_ED_EXPORT UndoRedoArena
+	{
+		/** Header of a single chunk. Chunk data immediately follows the header. */
+		struct Chunk
+		{
+			UndoRedoArena* owner;
+			UINT32 size;
+			UINT32 used;
+			UINT32 numAllocations;
+		};
+
+	public:
+		/** 
+		 * Creates a new arena.
+		 *
+		 * @param[in]	chunkSize	Size of a single chunk, in bytes. Allocations larger than half the chunk size get a 
+		 *							chunk of their own.
+		 */
+		UndoRedoArena(UINT32 chunkSize = 64 * 1024);
+		~UndoRedoArena();
+
+		UndoRedoArena(const UndoRedoArena&) = delete;
+		UndoRedoArena& operator=(const UndoRedoArena&) = delete;
+
+		/** 
+		 * Allocates a block of memory of the specified size, aligned to 16 bytes. Size of a single allocation is limited
+		 * to what fits in a chunk, slightly less than 4GB.
+		 */
+		void* allocate(size_t size);
+
+		/** Frees memory previously allocated with allocate(), from any arena. */
+		static void free(void* data);
+
+		/** 
+		 * Wraps an object constructed in memory allocated from this arena in a shared pointer. The shared pointer's
+		 * control block is allocated from the arena as well. 
+		 */
+		template<class T>
+		SPtr<T> makeShared(T* data)
+		{
+			return SPtr<T>(data, &UndoRedoArena::destruct<T>, Allocator<T>(this));
+		}
+
+		/** Constructs a new object in memory allocated from this arena and wraps it in a shared pointer. */
+		template<class T, class... Args>
+		SPtr<T> newShared(Args&&... args)
+		{
+			return makeShared(new (allocate(sizeof(T))) T(std::forward<Args>(args)...));
+		}
+
+		/** Returns the total number of allocations made from the arena. */
+		UINT64 getNumAllocations() const { return mNumAllocations; }
+
+		/** Returns the number of chunks the arena requested from the system allocator. */
+		UINT64 getNumChunkAllocations() const { return mNumChunkAllocations; }
+
+		/** Returns the number of chunks currently held by the arena. */
+		UINT32 getNumChunks() const { return (UINT32)mChunks.size(); }
+
+		/** Returns the amount of memory in chunks currently held by the arena, in bytes. */
+		UINT64 getMemoryUsage() const { return mMemoryUsage; }
+
+		/** STL compatible allocator that allocates from an undo/redo arena. */
+		template<class T>
+		class Allocator
+		{
+		public:
+			using value_type = T;
+
+			Allocator(UndoRedoArena* arena)
+				:mArena(arena)
+			{ }
+
+			template<class U>
+			Allocator(const Allocator<U>& other)
+				:mArena(other.mArena)
+			{ }
+
+			T* allocate(size_t num) { return (T*)mArena->allocate(num * sizeof(T)); }
+			void deallocate(T* data, size_t num) { UndoRedoArena::free(data); }
+
+			template<class U>
+			bool operator==(const Allocator<U>& other) const { return mArena == other.mArena; }
+
+			template<class U>
+			bool operator!=(const Allocator<U>& other) const { return mArena != other.mArena; }
+
+		private:
+			template<class U>
+			friend class Allocator;
+
+			UndoRedoArena* mArena;
+		};
+
+	private:
+		/** Destroys an object allocated from an arena, and frees its memory. */
+		template<class T>
+		static void destruct(T* data)
+		{
+			data->~T();
+			free(data);
+		}
+
+		/** Allocates a new chunk able to hold at least @p size bytes. */
+		Chunk* allocateChunk(UINT32 size);
+
+		/** Triggered when all allocations from a chunk owned by this arena have been freed. */
+		void onChunkEmpty(Chunk* chunk);
+
+		UINT32 mChunkSize;
+		Chunk* mCurrentChunk = nullptr;
+		Chunk* mSpareChunk = nullptr;
+		UnorderedSet<Chunk*> mChunks;
+
+		UINT64 mNumAllocations = 0;
+		UINT64 mNumChunkAllocations = 0;
+		UINT64 mMemoryUsage = 0;
+	};
+
+	/** @} */
+}
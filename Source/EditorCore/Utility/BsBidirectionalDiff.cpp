@@ -0,0 +1,135 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsBidirectionalDiff.h"
+#include "Serialization/BsBinaryDiff.h"
+#include "Reflection/BsRTTIType.h"
+
+namespace bs
+{
+	/**
+	 * Returns a value that restores the provided original value, given the value stored for the same field in the
+	 * forward diff. Objects and arrays are handled recursively so only the modified parts of the original are copied.
+	 */
+	static SPtr<SerializedInstance> generateReverseValue(const SPtr<SerializedInstance>& orgValue,
+		const SPtr<SerializedInstance>& diffValue)
+	{
+		if (orgValue == nullptr)
+			return nullptr;
+
+		// Value was cleared in the new state, restore the whole thing
+		if (diffValue == nullptr)
+			return orgValue->clone();
+
+		if (rtti_is_of_type<SerializedObject>(orgValue.get()) && rtti_is_of_type<SerializedObject>(diffValue.get()))
+		{
+			SPtr<SerializedObject> orgObj = std::static_pointer_cast<SerializedObject>(orgValue);
+			SPtr<SerializedObject> diffObj = std::static_pointer_cast<SerializedObject>(diffValue);
+
+			// If the type changed the diff holds the entire new object, rather than just the modified fields
+			if (orgObj->getRootTypeId() != diffObj->getRootTypeId())
+				return orgValue->clone();
+
+			return BidirectionalDiff::generateReverse(orgObj, diffObj);
+		}
+
+		if (rtti_is_of_type<SerializedArray>(orgValue.get()) && rtti_is_of_type<SerializedArray>(diffValue.get()))
+		{
+			SPtr<SerializedArray> orgArray = std::static_pointer_cast<SerializedArray>(orgValue);
+			SPtr<SerializedArray> diffArray = std::static_pointer_cast<SerializedArray>(diffValue);
+
+			SPtr<SerializedArray> output = bs_shared_ptr_new<SerializedArray>();
+			output->numElements = orgArray->numElements;
+
+			for (auto& diffEntry : diffArray->entries)
+			{
+				// Entries past the original size were added, resizing the array back is enough to remove them
+				auto iterFind = orgArray->entries.find(diffEntry.first);
+				if (iterFind == orgArray->entries.end())
+					continue;
+
+				SerializedArrayEntry entry;
+				entry.index = diffEntry.first;
+				entry.serialized = generateReverseValue(iterFind->second.serialized, diffEntry.second.serialized);
+
+				output->entries[entry.index] = entry;
+			}
+
+			// Entries that were removed by shrinking the array need to be restored
+			for (auto& orgEntry : orgArray->entries)
+			{
+				if (orgEntry.first < diffArray->numElements)
+					continue;
+
+				SerializedArrayEntry entry;
+				entry.index = orgEntry.first;
+				entry.serialized = orgEntry.second.serialized != nullptr ? orgEntry.second.serialized->clone() : nullptr;
+
+				output->entries[entry.index] = entry;
+			}
+
+			return output;
+		}
+
+		// Plain fields, data blocks and mismatched types are stored in full
+		return orgValue->clone();
+	}
+
+	bool BidirectionalDiff::generate(const SPtr<SerializedObject>& orgObj, const SPtr<SerializedObject>& newObj,
+		SPtr<SerializedObject>& forward, SPtr<SerializedObject>& reverse)
+	{
+		forward = nullptr;
+		reverse = nullptr;
+
+		if (orgObj == nullptr || newObj == nullptr)
+			return false;
+
+		BinaryDiff diffHandler;
+		forward = diffHandler.generateDiff(orgObj, newObj);
+		if (forward == nullptr)
+			return false;
+
+		reverse = generateReverse(orgObj, forward);
+		return true;
+	}
+
+	SPtr<SerializedObject> BidirectionalDiff::generateReverse(const SPtr<SerializedObject>& orgObj,
+		const SPtr<SerializedObject>& forward)
+	{
+		SPtr<SerializedObject> output = bs_shared_ptr_new<SerializedObject>();
+		for (auto& diffSubObject : forward->subObjects)
+		{
+			const SerializedSubObject* orgSubObject = nullptr;
+			for (auto& subObject : orgObj->subObjects)
+			{
+				if (subObject.typeId == diffSubObject.typeId)
+				{
+					orgSubObject = &subObject;
+					break;
+				}
+			}
+
+			if (orgSubObject == nullptr)
+				continue;
+
+			SerializedSubObject reverseSubObject;
+			reverseSubObject.typeId = diffSubObject.typeId;
+
+			for (auto& diffEntry : diffSubObject.entries)
+			{
+				auto iterFind = orgSubObject->entries.find(diffEntry.first);
+				if (iterFind == orgSubObject->entries.end())
+					continue;
+
+				SerializedEntry entry;
+				entry.fieldId = diffEntry.first;
+				entry.serialized = generateReverseValue(iterFind->second.serialized, diffEntry.second.serialized);
+
+				reverseSubObject.entries[entry.fieldId] = entry;
+			}
+
+			output->subObjects.push_back(reverseSubObject);
+		}
+
+		return output;
+	}
+}
@@ -0,0 +1,50 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Serialization/BsSerializedObject.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Generates a pair of binary diffs between two serialized objects, one transforming the old state into the new state
+	 * and one transforming the new state back into the old state. Both diffs can be applied through the regular
+	 * IDiff::applyDiff() path.
+	 *
+	 * Only a single full traversal of the two objects is performed, for the forward diff. The reverse diff is built by
+	 * walking the (usually much smaller) forward diff and copying the matching values from the old state, meaning its
+	 * cost is proportional to the size of the change, not the size of the object.
+	 */
+	class BS_ED_EXPORT BidirectionalDiff
+	{
+	public:
+		/**
+		 * Generates the forward and reverse diffs between the provided objects.
+		 *
+		 * @param[in]	orgObj		Serialized object in its original state.
+		 * @param[in]	newObj		Serialized object in its modified state. Must be of the same type as @p orgObj.
+		 * @param[out]	forward		Diff that transforms @p orgObj into @p newObj. Null if the objects are equal.
+		 * @param[out]	reverse		Diff that transforms @p newObj into @p orgObj. Null if the objects are equal.
+		 * @return					True if any difference was found.
+		 */
+		static bool generate(const SPtr<SerializedObject>& orgObj, const SPtr<SerializedObject>& newObj,
+			SPtr<SerializedObject>& forward, SPtr<SerializedObject>& reverse);
+
+		/**
+		 * Generates a diff that undoes the provided forward diff.
+		 *
+		 * @param[in]	orgObj		Serialized object the forward diff was generated from.
+		 * @param[in]	forward		Diff generated from @p orgObj to some new state.
+		 * @return					Diff that transforms the new state back into @p orgObj.
+		 */
+		static SPtr<SerializedObject> generateReverse(const SPtr<SerializedObject>& orgObj,
+			const SPtr<SerializedObject>& forward);
+	};
+
+	/** @} */
+}
@@ -3,6 +3,7 @@
 #include "Utility/BsEditorUtility.h"
 #include "Scene/BsSceneObject.h"
 #include "Components/BsCRenderable.h"
+#include "Scene/BsSceneBoundsCache.h"
 
 namespace bs
 {
@@ -49,6 +50,62 @@ namespace bs
 		return AABox(Vector3::ZERO, Vector3::ZERO);
 	}
 
+	AABox EditorUtility::calculateHierarchyBounds(const Vector<HSceneObject>& objects)
+	{
+		if (objects.size() == 0)
+			return AABox(Vector3::ZERO, Vector3::ZERO);
+
+		AABox bounds = AABox(Vector3::INF, -Vector3::INF);
+		bool gotOneMesh = false;
+
+		if (SceneBoundsCache::isStarted())
+			gotOneMesh = SceneBoundsCache::instance().getHierarchyBounds(objects, bounds);
+		else
+		{
+			Vector<HSceneObject> todo;
+			for (auto& object : objects)
+			{
+				todo.push_back(object);
+				while (!todo.empty())
+				{
+					HSceneObject curObject = todo.back();
+					todo.pop_back();
+
+					AABox meshBounds;
+					if (calculateMeshBounds(curObject, meshBounds))
+					{
+						bounds.merge(meshBounds);
+						gotOneMesh = true;
+					}
+
+					if (curObject.isDestroyed())
+						continue;
+
+					UINT32 numChildren = curObject->getNumChildren();
+					for (UINT32 i = 0; i < numChildren; i++)
+						todo.push_back(curObject->getChild(i));
+				}
+			}
+		}
+
+		if (!gotOneMesh)
+		{
+			for (auto& object : objects)
+			{
+				if (object.isDestroyed())
+					continue;
+
+				bounds.merge(object->getTransform().getPosition());
+				gotOneMesh = true;
+			}
+		}
+
+		if(gotOneMesh)
+			return bounds;
+
+		return AABox(Vector3::ZERO, Vector3::ZERO);
+	}
+
 	Vector3 EditorUtility::calculateCenter(const Vector<HSceneObject>& objects)
 	{
 		if (objects.size() == 0)
@@ -89,12 +146,82 @@ namespace bs
 		return Vector3::ZERO;
 	}
 
+	Vector3 EditorUtility::calculateHierarchyCenter(const Vector<HSceneObject>& objects)
+	{
+		if (!SceneBoundsCache::isStarted())
+		{
+			Vector<HSceneObject> flattened;
+			Vector<HSceneObject> todo;
+			UnorderedSet<UINT64> visited;
+
+			for (auto& object : objects)
+			{
+				if (object.isDestroyed())
+					continue;
+
+				todo.push_back(object);
+				while (!todo.empty())
+				{
+					HSceneObject curObject = todo.back();
+					todo.pop_back();
+
+					if (!visited.insert(curObject->getInstanceId()).second)
+						continue;
+
+					flattened.push_back(curObject);
+
+					UINT32 numChildren = curObject->getNumChildren();
+					for (UINT32 i = 0; i < numChildren; i++)
+						todo.push_back(curObject->getChild(i));
+				}
+			}
+
+			return calculateCenter(flattened);
+		}
+
+		// Same as calculateCenter(), except both the bounds and position averages are accumulated in a single pass
+		Vector3 boundsCenter = Vector3::ZERO;
+		Vector3 positionCenter = Vector3::ZERO;
+		UINT32 boundsCount = 0;
+		UINT32 positionCount = 0;
+
+		SceneBoundsCache::instance().forEachInHierarchy(objects, 
+			[&](const HSceneObject& object, const AABox* bounds)
+		{
+			const Vector3& position = object->getTransform().getPosition();
+
+			if (bounds != nullptr)
+			{
+				if (bounds->getSize() == Vector3::INF)
+					boundsCenter += position;
+				else
+					boundsCenter += bounds->getCenter();
+
+				boundsCount++;
+			}
+
+			positionCenter += position;
+			positionCount++;
+		});
+
+		if (boundsCount > 0)
+			return boundsCenter / (float)boundsCount;
+
+		if (positionCount > 0)
+			return positionCenter / (float)positionCount;
+
+		return Vector3::ZERO;
+	}
+
 	bool EditorUtility::calculateMeshBounds(const HSceneObject& object, AABox& bounds)
 	{
 		bounds = AABox(Vector3::ZERO, Vector3::ZERO);
 		if (object.isDestroyed())
 			return false;
 
+		if (SceneBoundsCache::isStarted())
+			return SceneBoundsCache::instance().getBounds(object, bounds);
+
 		bool foundOne = false;
 		const Vector<HComponent>& components = object->getComponents();
 		for (auto& component : components)
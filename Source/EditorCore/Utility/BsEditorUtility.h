@@ -54,9 +54,21 @@ namespace bs
 		 */
 		static AABox calculateBounds(const Vector<HSceneObject>& objects);
 
+		/**
+		 * Calculates world space bounds of the specified scene objects and all their children. This will consider
+		 * components with bounds like Renderable.
+		 */
+		static AABox calculateHierarchyBounds(const Vector<HSceneObject>& objects);
+
 		/** Calculates world space center of the specified scene objects. */
 		static Vector3 calculateCenter(const Vector<HSceneObject>& objects);
 
+		/**
+		 * Calculates world space center of the specified scene objects and all their children. Equivalent to calling
+		 * calculateCenter() with a flattened list of all the objects in the hierarchies, without duplicates.
+		 */
+		static Vector3 calculateHierarchyCenter(const Vector<HSceneObject>& objects);
+
 		/**
 		 * Parses the scene object hierarchy and components and generates a hierarchy of instance data required to restore
 		 * the object identities.
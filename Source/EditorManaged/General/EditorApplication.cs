@@ -564,7 +564,11 @@ namespace bs.Editor
                         lastLoadedScene = null;
                     }
                     else
+                    {
+                        // Make sure a scene that was just saved isn't read while it's still being written
+                        ProjectLibrary.FinishSaves();
                         lastLoadedScene = Scene.LoadAsync(path);
+                    }
 
                     SetSceneDirty(false);
 
@@ -600,10 +604,11 @@ namespace bs.Editor
         ///                    prefab if it just needs updating. </param>
         internal static void SaveScene(string path)
         {
+            // Scene is written on a worker thread, and its library entry updated once done, so there's no need to
+            // refresh the library here
             Prefab scene = Internal_SaveScene(path);
             Scene.SetActive(scene);
 
-            ProjectLibrary.Refresh(true);
             SetSceneDirty(false);
         }
 
@@ -644,9 +649,9 @@ namespace bs.Editor
             
             if (root != null)
             {
+                // Applying the prefab updates its library entry, no need to refresh the library
                 PrefabUtility.ApplyPrefab(root, false);
 
-                ProjectLibrary.Refresh(true);
                 SetSceneDirty(false);
 
                 if (onSuccess != null)
@@ -819,11 +824,43 @@ namespace bs.Editor
             SetSceneDirty(true);
         }
 
+        /// <summary>
+        /// Marks the current scene as dirty, reporting only the provided objects as modified. Cheaper than
+        /// <see cref="SetSceneDirty()"/> for changes that are known to be limited to a few objects, as editor systems
+        /// only need to update the data they keep for those objects.
+        /// </summary>
+        /// <param name="modifiedObjects">Objects that were modified, along with their components and children.</param>
+        public static void SetSceneDirty(SceneObject[] modifiedObjects)
+        {
+            MarkSceneDirty(true);
+            Internal_NotifySceneModified(modifiedObjects);
+        }
+
+        /// <summary>
+        /// Reports modifications of the provided objects to the editor systems that keep data about the scene, without
+        /// marking the scene as dirty. Meant for temporary modifications, like animation previews.
+        /// </summary>
+        /// <param name="modifiedObjects">Objects that were modified, along with their components and children.</param>
+        internal static void NotifySceneModified(params SceneObject[] modifiedObjects)
+        {
+            Internal_NotifySceneModified(modifiedObjects);
+        }
+
         /// <summary>
         /// Marks the current scene as clean or dirty.
         /// </summary>
         /// <param name="dirty">Should the scene be marked as clean or dirty.</param>
         internal static void SetSceneDirty(bool dirty)
+        {
+            MarkSceneDirty(dirty);
+            Internal_NotifySceneModified(null);
+        }
+
+        /// <summary>
+        /// Updates the dirty state of the current scene, without reporting any modifications.
+        /// </summary>
+        /// <param name="dirty">Should the scene be marked as clean or dirty.</param>
+        private static void MarkSceneDirty(bool dirty)
         {
             sceneDirty = dirty;
             SetStatusScene(Scene.ActiveSceneName, dirty);
@@ -1002,6 +1039,22 @@ namespace bs.Editor
 #endif
         }
 
+        /// <summary>
+        /// Runs the scene view benchmark on a synthetic scene and saves the results as JSON in the project's internal
+        /// folder, so they can be compared between runs.
+        /// </summary>
+        [MenuItem("Tools/Benchmarks/Scene View", 9240)]
+        private static void RunSceneViewBenchmark()
+        {
+            if (!IsProjectLoaded)
+                return;
+
+            string outputPath = Path.Combine(ProjectPath, "Internal", "Benchmarks", "SceneView.json");
+            Internal_RunSceneViewBenchmark(outputPath);
+
+            Debug.Log("Scene view benchmark results saved to: " + outputPath);
+        }
+
         /// <summary>
         /// Triggered by the runtime when <see cref="LoadProject"/> method completes.
         /// </summary>
@@ -1169,6 +1222,12 @@ namespace bs.Editor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern bool Internal_HasFocus();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_NotifySceneModified(SceneObject[] modifiedObjects);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_RunSceneViewBenchmark(string outputPath);
     }
 
     /** @} */
@@ -20,6 +20,7 @@ namespace bs.Editor
 			value.iconSizeMin = 0.0500000007f;
 			value.iconSizeMax = 0.150000006f;
 			value.iconSizeCull = 0.25f;
+			value.shapeRange = 0f;
 
 			return value;
 		}
@@ -43,5 +44,10 @@ namespace bs.Editor
 		/// (e.g. 1 means the icons fully covers the viewport). In range [0, 1], should be larger than maximum size value.
 		/// </summary>
 		public float iconSizeCull;
+		/// <summary>
+		/// Maximum range at which gizmos other than icons will be rendered, in world units. Zero or negative values  disable 
+		/// range culling.
+		/// </summary>
+		public float shapeRange;
 	}
 }
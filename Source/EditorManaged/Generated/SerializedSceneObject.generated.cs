@@ -41,10 +41,34 @@ namespace bs.Editor
 			Internal_restore(mCachedPtr);
 		}
 
+		/// <summary>
+		/// Returns the amount of memory used by the serialized state, in bytes. Data moved to disk is not counted.
+		/// </summary>
+		public ulong GetMemoryUsage()
+		{
+			return Internal_getMemoryUsage(mCachedPtr);
+		}
+
+		/// <summary>
+		/// Compresses the serialized state on a worker thread, reducing its memory footprint. The state is decompressed on 
+		/// demand when restore() is called. Does nothing if the state is already compressed.
+		/// </summary>
+		/// <param name="spillToDisk">
+		/// If true the compressed state will be written to a temporary file and released from memory.
+		/// </param>
+		public void Compress(bool spillToDisk = false)
+		{
+			Internal_compress(mCachedPtr, spillToDisk);
+		}
+
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern void Internal_SerializedSceneObject(SerializedSceneObject managedInstance, SceneObject sceneObject, bool hierarchy);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		private static extern void Internal_restore(IntPtr thisPtr);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern ulong Internal_getMemoryUsage(IntPtr thisPtr);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		private static extern void Internal_compress(IntPtr thisPtr, bool spillToDisk);
 	}
 
 	/** @} */
@@ -772,6 +772,68 @@ namespace bs.Editor
             */
         }
 
+        /// <summary>
+        /// Tests merging of continuous field edits into a single undo command.
+        /// </summary>
+        static void UnitTest5_UndoCoalescing()
+        {
+            SceneObject so = new SceneObject("TestSO");
+            UT1_Component1 cmp1 = so.AddComponent<UT1_Component1>();
+            UT1_Component2 cmp2 = so.AddComponent<UT1_Component2>();
+
+            // Commands registered within the group are removed together with it
+            UndoRedo.Global.PushGroup("UnitTest5");
+            try
+            {
+                // Continuous edits of the same field are merged
+                for (int i = 1; i <= 3; i++)
+                {
+                    GameObjectUndo.RecordComponent(cmp1, "a", true);
+                    cmp1.a = i;
+                    GameObjectUndo.ResolveDiffs();
+                }
+
+                Assert(UndoRedo.Global.TopCommandId != 0);
+
+                UndoRedo.Global.Undo();
+                Assert(cmp1.a == 0);
+
+                UndoRedo.Global.Redo();
+                Assert(cmp1.a == 3);
+
+                // Separate edits are not
+                GameObjectUndo.RecordComponent(cmp1, "a");
+                cmp1.a = 4;
+                GameObjectUndo.ResolveDiffs();
+
+                GameObjectUndo.RecordComponent(cmp1, "a");
+                cmp1.a = 5;
+                GameObjectUndo.ResolveDiffs();
+
+                UndoRedo.Global.Undo();
+                Assert(cmp1.a == 4);
+
+                // Edits spanning multiple components are merged per component
+                for (int i = 1; i <= 3; i++)
+                {
+                    GameObjectUndo.RecordComponent(cmp1, "a", true);
+                    GameObjectUndo.RecordComponent(cmp2, "a2", true);
+                    cmp1.a = 10 + i;
+                    cmp2.a2 = 20 + i;
+                    GameObjectUndo.ResolveDiffs();
+                }
+
+                UndoRedo.Global.Undo();
+                UndoRedo.Global.Undo();
+                Assert(cmp1.a == 4 && cmp2.a2 == 0);
+            }
+            finally
+            {
+                UndoRedo.Global.PopGroup("UnitTest5");
+                so.Destroy();
+            }
+        }
+
         /// <summary>
         /// Runs all tests.
         /// </summary>
@@ -781,6 +843,7 @@ namespace bs.Editor
             UnitTest2_SerializableProperties();
             UnitTest3_ManagedDiff();
             UnitTest4_Prefabs();
+            UnitTest5_UndoCoalescing();
         }
 
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -56,6 +56,19 @@ namespace bs.Editor
             return center;
         }
 
+        /// <summary>
+        /// Calculates the center of all axis aligned boxes of the provided scene objects and all their children. Same as
+        /// calling <see cref="CalculateCenter"/> with flattened hierarchies of all the objects, but faster.
+        /// </summary>
+        /// <param name="objects">Scene objects whose hierarchies to calculate the center for.</param>
+        /// <returns>Center of the objects and their children in world space.</returns>
+        public static Vector3 CalculateHierarchyCenter(SceneObject[] objects)
+        {
+            Vector3 center;
+            Internal_CalculateHierarchyCenter(objects, out center);
+            return center;
+        }
+
         /// <summary>
         /// Converts a hierarchy of scene objects and their children into a flat array. Doesn't modify the scene object's
         /// themselves. 
@@ -116,6 +129,9 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_CalculateArrayCenter(SceneObject[] objects, out Vector3 center);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_CalculateHierarchyCenter(SceneObject[] objects, out Vector3 center);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern Resource[] Internal_FindDependencies(Resource resource, bool recursive);
 
@@ -0,0 +1,140 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System.Runtime.CompilerServices;
+
+namespace bs.Editor
+{
+    /** @addtogroup Utility-Editor
+     *  @{
+     */
+
+    /// <summary>
+    /// Timings recorded for a single editor window, in milliseconds, and managed memory allocations, in bytes.
+    /// </summary>
+    public struct EditorWidgetProfileStats
+    {
+        /// <summary>
+        /// Name of the window type the timings belong to.
+        /// </summary>
+        public string name;
+
+        /// <summary>
+        /// Total update time of the window during the last recorded frame.
+        /// </summary>
+        public float lastUpdate;
+
+        /// <summary>
+        /// Average total update time of the window over the recorded history.
+        /// </summary>
+        public float averageUpdate;
+
+        /// <summary>
+        /// Maximum total update time of the window over the recorded history.
+        /// </summary>
+        public float maxUpdate;
+
+        /// <summary>
+        /// Time spent in the window's OnEditorUpdate callback during the last recorded frame.
+        /// </summary>
+        public float lastManagedUpdate;
+
+        /// <summary>
+        /// Average time spent in the window's OnEditorUpdate callback over the recorded history.
+        /// </summary>
+        public float averageManagedUpdate;
+
+        /// <summary>
+        /// Maximum time spent in the window's OnEditorUpdate callback over the recorded history.
+        /// </summary>
+        public float maxManagedUpdate;
+
+        /// <summary>
+        /// Bytes of managed memory allocated by the window's OnEditorUpdate callback during the last recorded frame.
+        /// </summary>
+        public ulong lastManagedAlloc;
+
+        /// <summary>
+        /// Average bytes of managed memory allocated by the window's OnEditorUpdate callback over the recorded history.
+        /// </summary>
+        public ulong averageManagedAlloc;
+
+        /// <summary>
+        /// Maximum bytes of managed memory allocated by the window's OnEditorUpdate callback over the recorded history.
+        /// </summary>
+        public ulong maxManagedAlloc;
+    }
+
+    /// <summary>
+    /// Records how much CPU time each editor window spends updating every frame.
+    /// </summary>
+    public static class EditorWidgetProfiler
+    {
+        /// <summary>
+        /// Determines is the profiler recording samples. Disabling the profiler clears all recorded history.
+        /// </summary>
+        public static bool Enabled
+        {
+            get { return Internal_IsEnabled(); }
+            set { Internal_SetEnabled(value); }
+        }
+
+        /// <summary>
+        /// Returns timings for all windows with recorded samples, sorted by average update time.
+        /// </summary>
+        public static EditorWidgetProfileStats[] Stats
+        {
+            get
+            {
+                string[] names;
+                float[] timings;
+                ulong[] allocs;
+
+                Internal_GetStats(out names, out timings, out allocs);
+
+                EditorWidgetProfileStats[] output = new EditorWidgetProfileStats[names.Length];
+                for (int i = 0; i < names.Length; i++)
+                {
+                    int idx = i * 6;
+
+                    output[i].name = names[i];
+                    output[i].lastUpdate = timings[idx + 0];
+                    output[i].averageUpdate = timings[idx + 1];
+                    output[i].maxUpdate = timings[idx + 2];
+                    output[i].lastManagedUpdate = timings[idx + 3];
+                    output[i].averageManagedUpdate = timings[idx + 4];
+                    output[i].maxManagedUpdate = timings[idx + 5];
+
+                    int allocIdx = i * 3;
+                    output[i].lastManagedAlloc = allocs[allocIdx + 0];
+                    output[i].averageManagedAlloc = allocs[allocIdx + 1];
+                    output[i].maxManagedAlloc = allocs[allocIdx + 2];
+                }
+
+                return output;
+            }
+        }
+
+        /// <summary>
+        /// Exports all recorded samples in the Chrome trace event format, viewable through chrome://tracing.
+        /// </summary>
+        /// <returns>JSON string containing the trace events.</returns>
+        public static string ExportChromeTrace()
+        {
+            return Internal_ExportChromeTrace();
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetEnabled(bool enabled);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsEnabled();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetStats(out string[] names, out float[] timings, out ulong[] allocs);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern string Internal_ExportChromeTrace();
+    }
+
+    /** @} */
+}
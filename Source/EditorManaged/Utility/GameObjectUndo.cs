@@ -26,6 +26,8 @@ namespace bs.Editor
         {
             private Component obj;
             private string path;
+            private bool continuous;
+            private float recordTime;
             private SerializedObject orgState;
 
             /// <summary>
@@ -36,31 +38,49 @@ namespace bs.Editor
             /// Path to the field which should be focused when performing the undo/redo operation. This should be the path
             /// as provided by <see cref="InspectableField"/>.
             /// </param>
-            internal ComponentToRecord(Component obj, string path)
+            /// <param name="continuous">
+            /// True if the record continues the previously resolved edit of the same field.
+            /// </param>
+            internal ComponentToRecord(Component obj, string path, bool continuous)
             {
                 this.obj = obj;
                 this.path = path;
+                this.continuous = continuous;
 
+                recordTime = Time.RealElapsed;
                 orgState = SerializedObject.Create(obj);
             }
 
+            /// <summary>
+            /// Checks if this record continues the edit made by the provided record, in which case both should be merged
+            /// into a single undo command.
+            /// </summary>
+            /// <param name="previous">Record of the previously resolved edit.</param>
+            /// <returns>True if this record continues the previous edit.</returns>
+            internal bool Continues(ComponentToRecord previous)
+            {
+                return continuous && !string.IsNullOrEmpty(path) && obj == previous.obj && path == previous.path &&
+                    IsWithinCoalesceWindow(recordTime);
+            }
+
             /// <summary>
             /// Generates the diff from the previously recorded state and the current state. If there is a difference
             /// an undo command is recorded.
             /// </summary>
-            internal void RecordCommand()
+            /// <returns>True if an undo command was recorded.</returns>
+            internal bool RecordCommand()
             {
                 if (obj.IsDestroyed)
-                    return;
+                    return false;
 
                 SerializedObject newState = SerializedObject.Create(obj);
 
-                SerializedDiff oldToNew = SerializedDiff.Create(orgState, newState);
-                if (oldToNew == null || oldToNew.IsEmpty)
-                    return;
+                SerializedDiff oldToNew, newToOld;
+                if (!SerializedDiff.CreatePair(orgState, newState, out oldToNew, out newToOld))
+                    return false;
 
-                SerializedDiff newToOld = SerializedDiff.Create(newState, orgState);
                 UndoRedo.Global.RegisterCommand(new RecordComponentUndo(obj, path, oldToNew, newToOld));
+                return true;
             }
         }
 
@@ -73,6 +93,8 @@ namespace bs.Editor
         {
             private SceneObject[] objs;
             private string path;
+            private bool continuous;
+            private float recordTime;
             private SceneObjectState[] orgStates;
 
             /// <summary>
@@ -82,11 +104,16 @@ namespace bs.Editor
             /// <param name="path">
             /// Path to the field which should be focused when performing the undo/redo operation.
             /// </param>
-            internal SceneObjectHeaderToRecord(SceneObject obj, string path)
+            /// <param name="continuous">
+            /// True if the record continues the previously resolved edit of the same field.
+            /// </param>
+            internal SceneObjectHeaderToRecord(SceneObject obj, string path, bool continuous)
             {
                 this.objs = new [] { obj };
                 this.path = path;
+                this.continuous = continuous;
 
+                recordTime = Time.RealElapsed;
                 orgStates = new [] { SceneObjectState.Create(obj) };
             }
 
@@ -102,20 +129,36 @@ namespace bs.Editor
             {
                 this.objs = objs;
                 this.path = path;
+                this.continuous = false;
+
+                recordTime = Time.RealElapsed;
 
                 orgStates = new SceneObjectState[objs.Length];
                 for(int i = 0; i < orgStates.Length; i++)
                     orgStates[i] = SceneObjectState.Create(objs[i]);
             }
 
+            /// <summary>
+            /// Checks if this record continues the edit made by the provided record, in which case both should be merged
+            /// into a single undo command.
+            /// </summary>
+            /// <param name="previous">Record of the previously resolved edit.</param>
+            /// <returns>True if this record continues the previous edit.</returns>
+            internal bool Continues(SceneObjectHeaderToRecord previous)
+            {
+                return continuous && !string.IsNullOrEmpty(path) && path == previous.path &&
+                    previous.HasSameObjects(objs) && IsWithinCoalesceWindow(recordTime);
+            }
+
             /// <summary>
             /// Generates the diff from the previously recorded state and the current state. If there is a difference
             /// an undo command is recorded.
             /// </summary>
-            internal void RecordCommand()
+            /// <returns>True if an undo command was recorded.</returns>
+            internal bool RecordCommand()
             {
                 if (objs == null)
-                    return;
+                    return false;
 
                 List<SceneObjectHeaderUndo> headers = new List<SceneObjectHeaderUndo>();
                 for (int i = 0; i < objs.Length; i++)
@@ -135,8 +178,30 @@ namespace bs.Editor
 
                 }
 
-                if (headers.Count > 0)
-                    UndoRedo.Global.RegisterCommand(new RecordSceneObjectHeaderUndo(headers, path));
+                if (headers.Count == 0)
+                    return false;
+
+                UndoRedo.Global.RegisterCommand(new RecordSceneObjectHeaderUndo(headers, path));
+                return true;
+            }
+
+            /// <summary>
+            /// Checks if this record was made for the same set of scene objects as provided.
+            /// </summary>
+            /// <param name="others">Scene objects to compare with.</param>
+            /// <returns>True if both sets contain the same scene objects, in the same order.</returns>
+            internal bool HasSameObjects(SceneObject[] others)
+            {
+                if (objs == null || others == null || objs.Length != others.Length)
+                    return false;
+
+                for (int i = 0; i < objs.Length; i++)
+                {
+                    if (objs[i] != others[i])
+                        return false;
+                }
+
+                return true;
             }
         }
 
@@ -216,6 +281,17 @@ namespace bs.Editor
         private static List<SceneObjectToRecord> sceneObjects = new List<SceneObjectToRecord>();
         private static List<NewSceneObjectToRecord> newSceneObjects = new List<NewSceneObjectToRecord>();
 
+        /// <summary>
+        /// Maximum time in seconds between resolving an edit and recording its continuation, for both to be merged into
+        /// a single command.
+        /// </summary>
+        private const float COALESCE_WINDOW = 0.5f;
+
+        private static List<ComponentToRecord> lastComponents = new List<ComponentToRecord>();
+        private static List<SceneObjectHeaderToRecord> lastSceneObjectHeaders = new List<SceneObjectHeaderToRecord>();
+        private static List<int> lastCommandIds = new List<int>();
+        private static float lastResolveTime;
+
         /// <summary>
         /// Records the current state of the provided component, and generates a diff with the next state at the end of the
         /// frame. If change is detected an undo operation will be recorded. Generally you want to call this just before
@@ -226,9 +302,14 @@ namespace bs.Editor
         /// Path to the field which should be focused when performing the undo/redo operation. This should be the path
         /// as provided by <see cref="InspectableField"/>.
         /// </param>
-        public static void RecordComponent(Component obj, string fieldPath)
+        /// <param name="continuous">
+        /// True if the change continues an edit of the same field that was resolved just before, such as a value being
+        /// dragged and resolved every frame. Such changes are merged with the previous undo command, as long as it is
+        /// still on top of the undo stack. Leave false if every call starts a separate edit.
+        /// </param>
+        public static void RecordComponent(Component obj, string fieldPath, bool continuous = false)
         {
-            ComponentToRecord cmp = new ComponentToRecord(obj, fieldPath);
+            ComponentToRecord cmp = new ComponentToRecord(obj, fieldPath, continuous);
             components.Add(cmp);
         }
 
@@ -244,9 +325,13 @@ namespace bs.Editor
         /// <param name="fieldName">
         /// Name to the field which should be focused when performing the undo/redo operation.
         /// </param>
-        public static void RecordSceneObjectHeader(SceneObject obj, string fieldName)
+        /// <param name="continuous">
+        /// True if the change continues an edit of the same field that was resolved just before. See
+        /// <see cref="RecordComponent"/>.
+        /// </param>
+        public static void RecordSceneObjectHeader(SceneObject obj, string fieldName, bool continuous = false)
         {
-            SceneObjectHeaderToRecord so = new SceneObjectHeaderToRecord(obj, fieldName);
+            SceneObjectHeaderToRecord so = new SceneObjectHeaderToRecord(obj, fieldName, continuous);
             sceneObjectHeaders.Add(so);
         }
 
@@ -308,11 +393,36 @@ namespace bs.Editor
         /// </summary>
         public static void ResolveDiffs()
         {
+            if (components.Count == 0 && sceneObjectHeaders.Count == 0 && sceneObjects.Count == 0 &&
+                newSceneObjects.Count == 0)
+                return;
+
+            // When continuing the previous edit, replace its commands and keep the states they were recorded from
+            if (ContinuesLastEdit())
+            {
+                for (int i = 0; i < components.Count; i++)
+                    components[i] = lastComponents[i];
+
+                for (int i = 0; i < sceneObjectHeaders.Count; i++)
+                    sceneObjectHeaders[i] = lastSceneObjectHeaders[i];
+
+                for (int i = lastCommandIds.Count - 1; i >= 0; i--)
+                    UndoRedo.Global.PopCommand(lastCommandIds[i]);
+            }
+
+            lastCommandIds.Clear();
+
             foreach (var entry in components)
-                entry.RecordCommand();
+            {
+                if (entry.RecordCommand())
+                    lastCommandIds.Add(UndoRedo.Global.TopCommandId);
+            }
 
             foreach (var entry in sceneObjectHeaders)
-                entry.RecordCommand();
+            {
+                if (entry.RecordCommand())
+                    lastCommandIds.Add(UndoRedo.Global.TopCommandId);
+            }
 
             foreach (var entry in sceneObjects)
                 entry.RecordCommand();
@@ -320,11 +430,68 @@ namespace bs.Editor
             foreach (var entry in newSceneObjects)
                 entry.RecordCommand();
 
+            // Only edits made purely of field changes can be continued
+            lastComponents.Clear();
+            lastSceneObjectHeaders.Clear();
+
+            if (sceneObjects.Count == 0 && newSceneObjects.Count == 0 && lastCommandIds.Count > 0)
+            {
+                lastComponents.AddRange(components);
+                lastSceneObjectHeaders.AddRange(sceneObjectHeaders);
+                lastResolveTime = Time.RealElapsed;
+            }
+            else
+                lastCommandIds.Clear();
+
             components.Clear();
             sceneObjectHeaders.Clear();
             sceneObjects.Clear();
             newSceneObjects.Clear();
         }
+
+        /// <summary>
+        /// Checks if the pending records continue the previously resolved edit. This is true if every record continues
+        /// the matching record of the previous edit, and the commands registered by the previous edit are still on top
+        /// of the undo stack.
+        /// </summary>
+        /// <returns>True if the pending records should replace the commands of the previous edit.</returns>
+        private static bool ContinuesLastEdit()
+        {
+            if (lastCommandIds.Count == 0 || sceneObjects.Count > 0 || newSceneObjects.Count > 0)
+                return false;
+
+            if (components.Count != lastComponents.Count || sceneObjectHeaders.Count != lastSceneObjectHeaders.Count)
+                return false;
+
+            if (UndoRedo.Global.TopCommandId != lastCommandIds[lastCommandIds.Count - 1])
+                return false;
+
+            for (int i = 0; i < components.Count; i++)
+            {
+                if (!components[i].Continues(lastComponents[i]))
+                    return false;
+            }
+
+            for (int i = 0; i < sceneObjectHeaders.Count; i++)
+            {
+                if (!sceneObjectHeaders[i].Continues(lastSceneObjectHeaders[i]))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Checks if a record was made soon enough after the previous edit was resolved to be a part of the same edit.
+        /// </summary>
+        /// <param name="recordTime">
+        /// Time at which the record was made, as reported by <see cref="Time.RealElapsed"/>.
+        /// </param>
+        /// <returns>True if the record can continue the previous edit.</returns>
+        private static bool IsWithinCoalesceWindow(float recordTime)
+        {
+            return (recordTime - lastResolveTime) <= COALESCE_WINDOW;
+        }
     }
 
     /// <summary>
@@ -609,6 +776,18 @@ namespace bs.Editor
             obj.Destroy(true);
         }
 
+        /// <inheritdoc/>
+        protected override ulong GetMemoryUsage()
+        {
+            return state?.GetMemoryUsage() ?? 0;
+        }
+
+        /// <inheritdoc/>
+        protected override void OnCold(bool spillToDisk)
+        {
+            state?.Compress(spillToDisk);
+        }
+
         /// <summary>
         /// Selects the scene object if not already selected.
         /// </summary>
@@ -680,6 +859,19 @@ namespace bs.Editor
             RefreshInspector();
         }
 
+        /// <inheritdoc/>
+        protected override ulong GetMemoryUsage()
+        {
+            return (oldState?.GetMemoryUsage() ?? 0) + (newState?.GetMemoryUsage() ?? 0);
+        }
+
+        /// <inheritdoc/>
+        protected override void OnCold(bool spillToDisk)
+        {
+            oldState?.Compress(spillToDisk);
+            newState?.Compress(spillToDisk);
+        }
+
         /// <summary>
         /// Selects the scene object if not already selected.
         /// </summary>
@@ -34,8 +34,8 @@ namespace bs.Editor
         /// is not a prefab instance nothing happens.
         /// </summary>
         /// <param name="obj">Prefab instance whose prefab to update.</param>
-        /// <param name="refreshScene">If true, all prefab instances in the current scene will be updated so they consistent
-        ///                            with the newly saved data.</param>
+        /// <param name="refreshScene">If true, all instances of the prefab in the current scene will be updated so they
+        ///                            are consistent with the newly saved data.</param>
         public static void ApplyPrefab(SceneObject obj, bool refreshScene = true)
         {
             if (obj == null)
@@ -45,14 +45,16 @@ namespace bs.Editor
             if (prefabInstanceRoot == null)
                 return;
 
+            // Only instances of the applied prefab need to be rebuilt, so there's no need to record or update any others.
+            // Each of those instances is still fully rebuilt from the prefab and has its diff re-applied.
+            UUID prefabUUID = GetPrefabUUID(prefabInstanceRoot);
             if (refreshScene)
             {
                 SceneObject root = Scene.Root;
                 if (root != null)
-                    Internal_RecordPrefabDiff(root.GetCachedPtr());
+                    Internal_RecordInstanceDiffs(root.GetCachedPtr(), ref prefabUUID);
             }
 
-            UUID prefabUUID = GetPrefabUUID(prefabInstanceRoot);
             string prefabPath = ProjectLibrary.GetPath(prefabUUID);
             Prefab prefab = ProjectLibrary.Load<Prefab>(prefabPath);
             if (prefab != null)
@@ -68,7 +70,7 @@ namespace bs.Editor
             {
                 SceneObject root = Scene.Root;
                 if (root != null)
-                    Internal_UpdateFromPrefab(root.GetCachedPtr());
+                    Internal_UpdateInstances(root.GetCachedPtr(), ref prefabUUID);
             }
         }
 
@@ -156,6 +158,12 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_RecordPrefabDiff(IntPtr soPtr);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_RecordInstanceDiffs(IntPtr rootPtr, ref UUID prefabUUID);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UpdateInstances(IntPtr rootPtr, ref UUID prefabUUID);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_RevertPrefab(IntPtr soPtr);
 
@@ -90,6 +90,39 @@ namespace bs.Editor
             return Internal_CreateDiff(oldObjPtr, newObjPtr);
         }
 
+        /// <summary>
+        /// Creates differences between <paramref name="oldObj"/> and <paramref name="newObj"/> in both directions. This
+        /// is equivalent to calling <see cref="Create(SerializedObject, SerializedObject)"/> twice with swapped
+        /// parameters, but is faster as the reverse difference is built from the forward one instead of comparing the
+        /// objects again.
+        /// </summary>
+        /// <param name="oldObj">Object to compare from.</param>
+        /// <param name="newObj">Object to compare to.</param>
+        /// <param name="oldToNew">
+        /// Difference that can be applied to <paramref name="oldObj"/> to restore it to the same state as
+        /// <paramref name="newObj"/>. Null if the objects are equal.
+        /// </param>
+        /// <param name="newToOld">
+        /// Difference that can be applied to <paramref name="newObj"/> to restore it to the same state as
+        /// <paramref name="oldObj"/>. Null if the objects are equal.
+        /// </param>
+        /// <returns>True if any differences between the objects were found.</returns>
+        public static bool CreatePair(SerializedObject oldObj, SerializedObject newObj, out SerializedDiff oldToNew,
+            out SerializedDiff newToOld)
+        {
+            oldToNew = null;
+            newToOld = null;
+
+            if (oldObj == null || newObj == null)
+                return false;
+
+            IntPtr oldObjPtr = oldObj.GetCachedPtr();
+            IntPtr newObjPtr = newObj.GetCachedPtr();
+            oldToNew = Internal_CreateDiffPair(oldObjPtr, newObjPtr, out newToOld);
+
+            return oldToNew != null && !oldToNew.IsEmpty;
+        }
+
         /// <summary>
         /// Applies difference stored in this object to the provided object. The type of the object must be the same as the
         /// type of objects the difference was generated from.
@@ -106,6 +139,10 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern SerializedDiff Internal_CreateDiff(IntPtr oldObj, IntPtr newObj);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern SerializedDiff Internal_CreateDiffPair(IntPtr oldObj, IntPtr newObj,
+            out SerializedDiff reverse);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_ApplyDiff(IntPtr thisPtr, object obj);
 
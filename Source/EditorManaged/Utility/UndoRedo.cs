@@ -11,6 +11,63 @@ namespace bs.Editor
      *  @{
      */
 
+    /// <summary>
+    /// Information about a single command in the undo/redo stacks, used for profiling.
+    /// </summary>
+    public struct UndoRedoCommandInfo
+    {
+        /// <summary>
+        /// Unique identifier of the command, as accepted by <see cref="UndoRedo.PopCommand"/>.
+        /// </summary>
+        public int id;
+
+        /// <summary>
+        /// Name of the command type.
+        /// </summary>
+        public string type;
+
+        /// <summary>
+        /// Description provided when the command was created.
+        /// </summary>
+        public string description;
+
+        /// <summary>
+        /// Estimate of the memory used by the command, in bytes.
+        /// </summary>
+        public ulong memoryUsage;
+
+        /// <summary>
+        /// Time at which the command was created, in microseconds since application start.
+        /// </summary>
+        public ulong creationTime;
+
+        /// <summary>
+        /// Duration of the last commit, in milliseconds. Includes the initial commit performed when the command was
+        /// registered, if it was registered together with its commit. Zero if never committed by the stack.
+        /// </summary>
+        public float lastCommitTime;
+
+        /// <summary>
+        /// Duration of the last revert executed through undo, in milliseconds. Zero if never undone.
+        /// </summary>
+        public float lastRevertTime;
+
+        /// <summary>
+        /// Number of times the command was committed by the stack, either on registration or through redo.
+        /// </summary>
+        public int numCommits;
+
+        /// <summary>
+        /// Number of times the command was undone.
+        /// </summary>
+        public int numReverts;
+
+        /// <summary>
+        /// True if the command is on the redo stack, false if it is on the undo stack.
+        /// </summary>
+        public bool isRedo;
+    }
+
     /// <summary>
     /// Provides functionality to undo or redo recently performed operations in the editor. All commands executed from this
     /// class are undoable/redoable.
@@ -46,13 +103,54 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Returns the unique identifier of the command currently at the top of the undo stack.
+        /// Triggered whenever commands are added to, removed from or moved between the global undo and redo stacks.
+        /// </summary>
+        public static event Action OnGlobalStackChanged;
+
+        /// <summary>
+        /// Returns the unique identifier of the command currently at the top of the undo stack, or zero if the undo stack
+        /// is empty. Commands are never assigned a zero identifier.
         /// </summary>
         public int TopCommandId
         {
             get { return Internal_GetTopCommandId(mCachedPtr); }
         }
 
+        /// <summary>
+        /// Returns information about all the commands in the undo/redo stacks. Undo stack commands are returned first,
+        /// starting with the most recent one, followed by the redo stack commands, starting with the next one to be redone.
+        /// </summary>
+        public UndoRedoCommandInfo[] Commands
+        {
+            get
+            {
+                string[] types;
+                string[] descriptions;
+                int[] counters;
+                ulong[] sizes;
+                float[] timings;
+
+                Internal_GetCommandInfo(mCachedPtr, out types, out descriptions, out counters, out sizes, out timings);
+
+                UndoRedoCommandInfo[] output = new UndoRedoCommandInfo[types.Length];
+                for (int i = 0; i < types.Length; i++)
+                {
+                    output[i].id = counters[i * 4 + 0];
+                    output[i].type = types[i];
+                    output[i].description = descriptions[i];
+                    output[i].memoryUsage = sizes[i * 2 + 0];
+                    output[i].creationTime = sizes[i * 2 + 1];
+                    output[i].lastCommitTime = timings[i * 2 + 0];
+                    output[i].lastRevertTime = timings[i * 2 + 1];
+                    output[i].numCommits = counters[i * 4 + 1];
+                    output[i].numReverts = counters[i * 4 + 2];
+                    output[i].isRedo = counters[i * 4 + 3] != 0;
+                }
+
+                return output;
+            }
+        }
+
         /// <summary>
         /// Executes the last command on the undo stack, undoing its operations.
         /// </summary>
@@ -202,6 +300,28 @@ namespace bs.Editor
                 Internal_DeleteSO(so.GetCachedPtr(), description);
         }
 
+        /// <summary>
+        /// Deletes a set of scene objects. All objects are deleted and restored together, as a single operation. Undo
+        /// operation recorded in global undo/redo stack.
+        /// </summary>
+        /// <param name="so">Scene objects to delete.</param>
+        /// <param name="description">Optional description of what exactly the command does.</param>
+        public static void DeleteSO(SceneObject[] so, string description = "")
+        {
+            if (so != null)
+            {
+                List<IntPtr> soPtrs = new List<IntPtr>();
+                for (int i = 0; i < so.Length; i++)
+                {
+                    if (so[i] != null)
+                        soPtrs.Add(so[i].GetCachedPtr());
+                }
+
+                if (soPtrs.Count > 0)
+                    Internal_DeleteSOMulti(soPtrs.ToArray(), description);
+            }
+        }
+
         /// <summary>
         /// Changes the parent of the scene object. Undo operation recorded in global undo/redo stack.
         /// </summary>
@@ -271,6 +391,15 @@ namespace bs.Editor
             UndoRedo.global = global;
         }
 
+        /// <summary>
+        /// Triggered by the runtime when the global undo/redo stack changes.
+        /// </summary>
+        private static void Internal_OnStackChanged()
+        {
+            if (OnGlobalStackChanged != null)
+                OnGlobalStackChanged();
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern void Internal_CreateInstance(UndoRedo instance);
 
@@ -298,6 +427,10 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern int Internal_GetTopCommandId(IntPtr thisPtr);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_GetCommandInfo(IntPtr thisPtr, out string[] types, out string[] descriptions,
+            out int[] counters, out ulong[] sizes, out float[] timings);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern SceneObject Internal_CloneSO(IntPtr soPtr, string description);
 
@@ -316,6 +449,9 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern void Internal_DeleteSO(IntPtr soPtr, string description);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_DeleteSOMulti(IntPtr[] soPtr, string description);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern void Internal_ReparentSO(IntPtr soPtr, IntPtr parentSOPtr, string description);
 
@@ -26,6 +26,25 @@ namespace bs.Editor
         /// </summary>
         protected abstract void Revert();
 
+        /// <summary>
+        /// Returns an estimate of the memory used by the command, in bytes. Used by the undo/redo stack for enforcing its
+        /// memory budget. Commands holding large amounts of data should override this.
+        /// </summary>
+        /// <returns>Memory used by the command, in bytes.</returns>
+        protected virtual ulong GetMemoryUsage()
+        {
+            return 0;
+        }
+
+        /// <summary>
+        /// Triggered when the command moves far enough down the undo stack that it is unlikely to be executed soon.
+        /// Commands holding large amounts of data may use this opportunity to compress it.
+        /// </summary>
+        /// <param name="spillToDisk">
+        /// True if the command is allowed to move its data from memory into a temporary file.
+        /// </param>
+        protected virtual void OnCold(bool spillToDisk) { }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_CreateInstance(UndoableCommand instance);
     }
@@ -83,6 +83,35 @@ namespace bs.Editor
             get { return Internal_IsActive(mCachedPtr); }
         }
 
+        /// <summary>
+        /// Returns the number of frames the window skipped its update because the editor was in idle mode and the window
+        /// had no pending changes.
+        /// </summary>
+        public ulong SkippedFrames
+        {
+            get { return Internal_GetNumSkippedFrames(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Determines should the window be updated every frame even when the editor is in idle mode. Should be enabled for
+        /// windows that animate or display contents that change on their own.
+        /// </summary>
+        public bool ContinuousUpdate
+        {
+            get { return Internal_GetContinuousUpdate(mCachedPtr); }
+            set { Internal_SetContinuousUpdate(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Notifies the window that its contents changed and it needs to be updated and redrawn. When idle mode is enabled,
+        /// windows without focus are only updated when marked dirty, when hovered over, or when scene, selection or project
+        /// library changes.
+        /// </summary>
+        public void MarkDirty()
+        {
+            Internal_MarkDirty(mCachedPtr);
+        }
+
         /// <summary>
         /// GUI panel that you may use for adding GUI elements to the window.
         /// </summary>
@@ -198,6 +227,18 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern bool Internal_IsPointerHovering(IntPtr nativeInstance);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_MarkDirty(IntPtr nativeInstance);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ulong Internal_GetNumSkippedFrames(IntPtr nativeInstance);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetContinuousUpdate(IntPtr nativeInstance, bool enabled);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetContinuousUpdate(IntPtr nativeInstance);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_GetBounds(IntPtr nativeInstance, out Rect2I bounds);
 
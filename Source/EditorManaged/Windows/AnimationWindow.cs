@@ -42,6 +42,8 @@ namespace bs.Editor
 
         private void OnInitialize()
         {
+            ContinuousUpdate = true;
+
             Selection.OnSelectionChanged += OnSelectionChanged;
 
             UpdateSelectedSO(true);
@@ -54,6 +56,11 @@ namespace bs.Editor
 
             guiCurveEditor.HandleDragAndZoomInput();
 
+            // Previewed animation modifies the object without going through the usual scene modification paths, and is
+            // evaluated with a delay, so report the object every frame
+            if (state != State.Empty)
+                EditorApplication.NotifySceneModified(selectedSO);
+
             if (state == State.Playback)
             {
                 Animation animation = selectedSO.GetComponent<Animation>();
@@ -602,6 +609,7 @@ namespace bs.Editor
 
                 // Reset generic curves to their initial values
                 UpdateGenericCurves(0.0f);
+                EditorApplication.NotifySceneModified(selectedSO);
             }
         }
 
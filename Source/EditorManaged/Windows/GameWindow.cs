@@ -102,6 +102,8 @@ namespace bs.Editor
 
         private void OnInitialize()
         {
+            ContinuousUpdate = true;
+
             GUILayoutY mainLayout = GUI.AddLayoutY();
 
             string[] aspectRatioTitles = new string[aspectRatios.Length + 1];
@@ -257,6 +257,20 @@ namespace bs.Editor
         /// </summary>
         /// <param name="subPath">Additional path to append to the end of the current field path.</param>
         protected void StartUndo(string subPath)
+        {
+            StartUndo(subPath, false);
+        }
+
+        /// <summary>
+        /// Notifies the system to start recording a new undo command. Any changes to the field after this is called
+        /// will be recorded in the command. User must call <see cref="EndUndo"/> after field is done being changed.
+        /// </summary>
+        /// <param name="subPath">Additional path to append to the end of the current field path.</param>
+        /// <param name="continuous">
+        /// True if the change continues the edit resolved just before, such as a value being dragged without the field
+        /// having input focus. See <see cref="GameObjectUndo.RecordComponent"/>.
+        /// </param>
+        protected void StartUndo(string subPath, bool continuous)
         {
             if (context.Component != null)
             {
@@ -264,7 +278,7 @@ namespace bs.Editor
                 if (!string.IsNullOrEmpty(subPath))
                     fullPath = path.TrimEnd('/') + '/' + subPath.TrimStart('/');
 
-                GameObjectUndo.RecordComponent(context.Component, fullPath);
+                GameObjectUndo.RecordComponent(context.Component, fullPath, continuous);
             }
         }
 
@@ -86,6 +86,18 @@ namespace bs.Editor
         /// <param name="newValue">New value of the int field.</param>
         private void OnFieldValueChanged(int newValue)
         {
+            // Dragging the label changes the value without focusing the field, and resolves on every step of the drag
+            if (!guiIntField.HasInputFocus)
+            {
+                StartUndo(null, true);
+
+                property.SetValue(newValue);
+                state = InspectableState.Modified;
+
+                EndUndo();
+                return;
+            }
+
             property.SetValue(newValue);
             state |= InspectableState.ModifyInProgress;
         }
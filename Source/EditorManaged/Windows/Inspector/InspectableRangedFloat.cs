@@ -75,6 +75,18 @@ namespace bs.Editor
         /// <param name="newValue">New value of the float field.</param>
         private void OnFieldValueChanged(float newValue)
         {
+            // Dragging the slider changes the value without focusing the field, and resolves on every step of the drag
+            if (!guiFloatField.HasInputFocus)
+            {
+                StartUndo(null, true);
+
+                property.SetValue(newValue);
+                state = InspectableState.Modified;
+
+                EndUndo();
+                return;
+            }
+
             property.SetValue(newValue);
             state |= InspectableState.ModifyInProgress;
         }
@@ -847,12 +847,24 @@ namespace bs.Editor
             if (activeSO == null)
                 return;
 
+            // Dragging a component label changes the value without focusing the field, and resolves on every step
+            bool dragged = !soPos.HasInputFocus;
+            if (dragged)
+                StartUndo("position." + component.ToString(), true);
+
             if (EditorApplication.ActiveCoordinateMode == HandleCoordinateMode.World)
                 activeSO.Position = soPos.Value;
             else
                 activeSO.LocalPosition = soPos.Value;
 
-            modifyState = InspectableState.ModifyInProgress;
+            if (dragged)
+            {
+                modifyState = InspectableState.Modified;
+                EndUndo();
+            }
+            else
+                modifyState = InspectableState.ModifyInProgress;
+
             EditorApplication.SetSceneDirty();
         }
 
@@ -867,6 +879,11 @@ namespace bs.Editor
             if (activeSO == null)
                 return;
 
+            // Dragging a component label changes the value without focusing the field, and resolves on every step
+            bool dragged = !soRot.HasInputFocus;
+            if (dragged)
+                StartUndo("rotation." + component.ToString(), true);
+
             Quaternion rotation = Quaternion.FromEuler(soRot.Value);
             if (EditorApplication.ActiveCoordinateMode == HandleCoordinateMode.World)
                 activeSO.Rotation = rotation;
@@ -874,7 +891,15 @@ namespace bs.Editor
                 activeSO.LocalRotation = rotation;
 
             lastRotation = rotation;
-            modifyState = InspectableState.ModifyInProgress;
+
+            if (dragged)
+            {
+                modifyState = InspectableState.Modified;
+                EndUndo();
+            }
+            else
+                modifyState = InspectableState.ModifyInProgress;
+
             EditorApplication.SetSceneDirty();
         }
 
@@ -889,9 +914,21 @@ namespace bs.Editor
             if (activeSO == null)
                 return;
 
+            // Dragging a component label changes the value without focusing the field, and resolves on every step
+            bool dragged = !soScale.HasInputFocus;
+            if (dragged)
+                StartUndo("scale." + component.ToString(), true);
+
             activeSO.LocalScale = soScale.Value;
 
-            modifyState = InspectableState.ModifyInProgress;
+            if (dragged)
+            {
+                modifyState = InspectableState.Modified;
+                EndUndo();
+            }
+            else
+                modifyState = InspectableState.ModifyInProgress;
+
             EditorApplication.SetSceneDirty();
         }
 
@@ -932,10 +969,14 @@ namespace bs.Editor
         /// changed.
         /// </summary>
         /// <param name="name">Name of the field being changed.</param>
-        private void StartUndo(string name)
+        /// <param name="continuous">
+        /// True if the change continues the edit resolved just before. See
+        /// <see cref="GameObjectUndo.RecordSceneObjectHeader(SceneObject,string,bool)"/>.
+        /// </param>
+        private void StartUndo(string name, bool continuous = false)
         {
             if (activeSO != null)
-                GameObjectUndo.RecordSceneObjectHeader(activeSO, name);
+                GameObjectUndo.RecordSceneObjectHeader(activeSO, name, continuous);
         }
 
         /// <summary>
@@ -309,6 +309,14 @@ namespace bs.Editor
             Internal_SetEditorData(path, userData);
         }
 
+        /// <summary>
+        /// Blocks until all resources queued for saving on worker threads have been written.
+        /// </summary>
+        internal static void FinishSaves()
+        {
+            Internal_FinishSaves();
+        }
+
         /// <summary>
         /// Triggers reimport for queued resource. Should be called once per frame.
         /// </summary>
@@ -373,6 +381,9 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_FinalizeImports();
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_FinishSaves();
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern int Internal_GetInProgressImportCount();
 
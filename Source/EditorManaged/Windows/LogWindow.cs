@@ -31,7 +31,8 @@ namespace bs.Editor
 
         private GUIListView<ConsoleGUIEntry, ConsoleEntryData> listView;
         private List<ConsoleEntryData> entries = new List<ConsoleEntryData>();
-        private List<ConsoleEntryData> filteredEntries = new List<ConsoleEntryData>();
+        private List<ConsoleEntryData> filteredEntries;
+        private List<ConsoleEntryData>[] filteredEntriesCache = new List<ConsoleEntryData>[(int)EntryFilter.All + 1];
         private EntryFilter filter = EntryFilter.All;
         private GUITexture detailsSeparator;
         private GUIScrollArea detailsArea;
@@ -194,6 +195,8 @@ namespace bs.Editor
         /// <param name="category">Category of the sub-system reporting the message.</param>
         private void OnEntryAdded(string message, LogVerbosity verbosity, int category)
         {
+            MarkDirty();
+
             // Check if compiler message or reported exception, otherwise parse it as a normal log message
             ParsedLogEntry logEntry = ScriptCodeManager.ParseCompilerMessage(message);
             if (logEntry == null)
@@ -209,12 +212,17 @@ namespace bs.Editor
             newEntry.message = logEntry.message;
 
             entries.Add(newEntry);
-            
-            if (DoesFilterMatch(verbosity))
+
+            // Keep all previously built filtered lists up to date (including the currently active one), so switching
+            // filters doesn't require re-evaluating the filter for every entry
+            for (int i = 0; i < filteredEntriesCache.Length; i++)
             {
-                listView.AddEntry(newEntry);
-                filteredEntries.Add(newEntry);
+                if (filteredEntriesCache[i] != null && DoesFilterMatch((EntryFilter)i, verbosity))
+                    filteredEntriesCache[i].Add(newEntry);
             }
+
+            if (DoesFilterMatch(filter, verbosity))
+                listView.AddEntry(newEntry);
         }
 
         /// <summary>
@@ -227,40 +235,58 @@ namespace bs.Editor
                 return;
 
             this.filter = filter;
+            filteredEntries = GetFilteredEntries(filter);
 
             listView.Clear();
-            filteredEntries.Clear();
-            foreach (var entry in entries)
+            for (int i = 0; i < filteredEntries.Count; i++)
+                listView.AddEntry(filteredEntries[i]);
+
+            sSelectedElementIdx = -1;
+        }
+
+        /// <summary>
+        /// Returns a list of all entries matching the provided filter. The list is built on first use and kept up to
+        /// date as new entries are added, until the entries are cleared.
+        /// </summary>
+        /// <param name="filter">Flags that control which type of messages should be returned.</param>
+        /// <returns>List of entries matching the filter, in the order they were added in.</returns>
+        private List<ConsoleEntryData> GetFilteredEntries(EntryFilter filter)
+        {
+            List<ConsoleEntryData> output = filteredEntriesCache[(int)filter];
+            if (output != null)
+                return output;
+
+            output = new List<ConsoleEntryData>(entries.Count);
+            for (int i = 0; i < entries.Count; i++)
             {
-                if (DoesFilterMatch(entry.verbosity))
-                {
-                    listView.AddEntry(entry);
-                    filteredEntries.Add(entry);
-                }
+                if (DoesFilterMatch(filter, entries[i].verbosity))
+                    output.Add(entries[i]);
             }
 
-            sSelectedElementIdx = -1;
+            filteredEntriesCache[(int)filter] = output;
+            return output;
         }
 
         /// <summary>
-        /// Checks if the currently active entry filter matches the provided type (the entry with the type that should be
+        /// Checks if the provided entry filter matches the provided type (the entry with the type that should be
         /// displayed).
         /// </summary>
+        /// <param name="filter">Flags that control which type of messages should be displayed.</param>
         /// <param name="verbosity">Message verbosity defining its importance.</param>
         /// <returns>True if the entry with the specified type should be displayed in the console.</returns>
-        private bool DoesFilterMatch(LogVerbosity verbosity)
+        private static bool DoesFilterMatch(EntryFilter filter, LogVerbosity verbosity)
         {
             switch (verbosity)
             {
                 case LogVerbosity.VeryVerbose:
                 case LogVerbosity.Verbose:
                 case LogVerbosity.Info:
-                    return filter.HasFlag(EntryFilter.Info);
+                    return (filter & EntryFilter.Info) != 0;
                 case LogVerbosity.Warning:
-                    return filter.HasFlag(EntryFilter.Warning);
+                    return (filter & EntryFilter.Warning) != 0;
                 case LogVerbosity.Error:
                 case LogVerbosity.Fatal:
-                    return filter.HasFlag(EntryFilter.Error);
+                    return (filter & EntryFilter.Error) != 0;
             }
 
             return false;
@@ -283,7 +309,15 @@ namespace bs.Editor
         {
             listView.Clear();
             entries.Clear();
-            filteredEntries.Clear();
+
+            // Keep the lists around so their storage can be reused
+            for (int i = 0; i < filteredEntriesCache.Length; i++)
+            {
+                if (filteredEntriesCache[i] != null)
+                    filteredEntriesCache[i].Clear();
+            }
+
+            filteredEntries = GetFilteredEntries(filter);
 
             sSelectedElementIdx = -1;
             RefreshDetailsPanel();
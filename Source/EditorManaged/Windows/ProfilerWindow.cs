@@ -0,0 +1,136 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System.IO;
+using bs;
+
+namespace bs.Editor
+{
+    /** @addtogroup Windows
+     *  @{
+     */
+
+    /// <summary>
+    /// Editor window that displays how much CPU time each open editor window spends updating every frame.
+    /// </summary>
+    internal class ProfilerWindow : EditorWindow
+    {
+        private const int TITLE_HEIGHT = 21;
+        private const int COLUMN_WIDTH = 90;
+        private const float REFRESH_INTERVAL = 0.5f;
+
+        private GUIScrollArea statsArea;
+        private float nextRefreshTime;
+
+        /// <summary>
+        /// Opens the profiler window.
+        /// </summary>
+        [MenuItem("Windows/Profiler", 6000)]
+        private static void OpenProfilerWindow()
+        {
+            OpenWindow<ProfilerWindow>();
+        }
+
+        /// <inheritdoc/>
+        protected override LocString GetDisplayName()
+        {
+            return new LocEdString("Profiler");
+        }
+
+        private void OnInitialize()
+        {
+            ContinuousUpdate = true;
+
+            GUILayoutY layout = GUI.AddLayoutY();
+            GUILayoutX titleLayout = layout.AddLayoutX();
+
+            GUIToggle recordBtn = new GUIToggle(new LocEdString("Record"), EditorStyles.Button, GUIOption.FixedHeight(TITLE_HEIGHT));
+            GUIButton exportBtn = new GUIButton(new LocEdString("Export trace"), GUIOption.FixedHeight(TITLE_HEIGHT));
+
+            titleLayout.AddElement(recordBtn);
+            titleLayout.AddFlexibleSpace();
+            titleLayout.AddElement(exportBtn);
+
+            recordBtn.Value = EditorWidgetProfiler.Enabled;
+            recordBtn.OnToggled += x =>
+            {
+                EditorWidgetProfiler.Enabled = x;
+                Refresh();
+            };
+
+            exportBtn.OnClick += ExportTrace;
+
+            statsArea = new GUIScrollArea();
+            layout.AddElement(statsArea);
+
+            Refresh();
+        }
+
+        private void OnEditorUpdate()
+        {
+            if (!EditorWidgetProfiler.Enabled || Time.RealElapsed < nextRefreshTime)
+                return;
+
+            Refresh();
+            nextRefreshTime = Time.RealElapsed + REFRESH_INTERVAL;
+        }
+
+        /// <summary>
+        /// Rebuilds the GUI displaying the per-window timings.
+        /// </summary>
+        private void Refresh()
+        {
+            statsArea.Layout.Clear();
+
+            if (!EditorWidgetProfiler.Enabled)
+            {
+                statsArea.Layout.AddElement(new GUILabel(new LocEdString("Enable recording to profile editor windows.")));
+                return;
+            }
+
+            AddRow(new LocEdString("Window"), new LocEdString("Avg. (ms)"), new LocEdString("Max. (ms)"),
+                new LocEdString("Script avg. (ms)"), new LocEdString("Script max. (ms)"), new LocEdString("GC avg. (KB)"),
+                new LocEdString("GC max. (KB)"));
+
+            EditorWidgetProfileStats[] stats = EditorWidgetProfiler.Stats;
+            for (int i = 0; i < stats.Length; i++)
+            {
+                AddRow(new LocEdString(stats[i].name),
+                    new LocEdString(stats[i].averageUpdate.ToString("F3")),
+                    new LocEdString(stats[i].maxUpdate.ToString("F3")),
+                    new LocEdString(stats[i].averageManagedUpdate.ToString("F3")),
+                    new LocEdString(stats[i].maxManagedUpdate.ToString("F3")),
+                    new LocEdString((stats[i].averageManagedAlloc / 1024.0f).ToString("F1")),
+                    new LocEdString((stats[i].maxManagedAlloc / 1024.0f).ToString("F1")));
+            }
+
+            statsArea.Layout.AddFlexibleSpace();
+        }
+
+        /// <summary>
+        /// Adds a new row to the timings table.
+        /// </summary>
+        /// <param name="name">Name of the window the row belongs to.</param>
+        /// <param name="values">Values to display in the remaining columns.</param>
+        private void AddRow(LocString name, params LocString[] values)
+        {
+            GUILayoutX rowLayout = statsArea.Layout.AddLayoutX();
+            rowLayout.AddSpace(5);
+            rowLayout.AddElement(new GUILabel(name, GUIOption.FlexibleWidth()));
+
+            for (int i = 0; i < values.Length; i++)
+                rowLayout.AddElement(new GUILabel(values[i], GUIOption.FixedWidth(COLUMN_WIDTH)));
+        }
+
+        /// <summary>
+        /// Asks the user for a location to save the recorded samples to, and saves them in the Chrome trace event format.
+        /// </summary>
+        private void ExportTrace()
+        {
+            string tracePath;
+            if (BrowseDialog.SaveFile(EditorApplication.ProjectPath, "*.json", out tracePath))
+                File.WriteAllText(tracePath, EditorWidgetProfiler.ExportChromeTrace());
+        }
+    }
+
+    /** @} */
+}
@@ -206,7 +206,7 @@ namespace bs.Editor
                     // Make sure to update handle positions for the drawing method (otherwise they lag one frame)
                     UpdateActiveHandleTransform(selectedSceneObjects);
 
-                    EditorApplication.SetSceneDirty();
+                    EditorApplication.SetSceneDirty(selectedSceneObjects);
                 }
             }
             else
@@ -241,13 +241,7 @@ namespace bs.Editor
             if (EditorApplication.ActivePivotMode == HandlePivotMode.Pivot)
                 position = selectedSceneObjects[0].Position; // Just take pivot from the first one, no averaging
             else
-            {
-                List<SceneObject> flatenedHierarchy = new List<SceneObject>();
-                foreach (var so in selectedSceneObjects)
-                    flatenedHierarchy.AddRange(EditorUtility.FlattenHierarchy(so));
-
-                position = EditorUtility.CalculateCenter(flatenedHierarchy.ToArray());
-            }
+                position = EditorUtility.CalculateHierarchyCenter(selectedSceneObjects);
 
             activeHandle.Position = position;
             activeHandle.Rotation = rotation;
@@ -208,6 +208,8 @@ namespace bs.Editor
 
         private void OnInitialize()
         {
+            ContinuousUpdate = true;
+
             if (ProjectSettings.HasKey(GizmoDrawSettingsKey))
                 gizmoDrawSettings = ProjectSettings.GetObject<GizmoDrawSettings>(SceneWindow.GizmoDrawSettingsKey);
             else
@@ -387,11 +389,13 @@ namespace bs.Editor
 
             if (selectedObjects.Length > 0)
             {
-                foreach (var so in selectedObjects)
-                {
-                    string message = "Deleted " + so.Name;
-                    UndoRedo.DeleteSO(so, message);
-                }
+                string message;
+                if (selectedObjects.Length == 1)
+                    message = "Deleted " + selectedObjects[0].Name;
+                else
+                    message = "Deleted " + selectedObjects.Length + " elements";
+
+                UndoRedo.DeleteSO(selectedObjects, message);
 
                 EditorApplication.SetSceneDirty();
             }
@@ -1114,20 +1118,15 @@ namespace bs.Editor
         ///                       output.</param>
         private void CleanDuplicates(ref SceneObject[] objects)
         {
+            HashSet<SceneObject> objectSet = new HashSet<SceneObject>(objects);
+
             List<SceneObject> cleanList = new List<SceneObject>();
             for (int i = 0; i < objects.Length; i++)
             {
                 bool foundParent = false;
-                for (int j = 0; j < objects.Length; j++)
+                for (SceneObject parent = objects[i].Parent; parent != null; parent = parent.Parent)
                 {
-                    SceneObject elem = objects[i];
-
-                    while (elem != null && elem != objects[j])
-                        elem = elem.Parent;
-
-                    bool isChildOf = elem == objects[j];
-
-                    if (i != j && isChildOf)
+                    if (objectSet.Contains(parent))
                     {
                         foundParent = true;
                         break;
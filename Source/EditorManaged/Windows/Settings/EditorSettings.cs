@@ -111,6 +111,25 @@ namespace bs.Editor
             set { Internal_SetMouseSensitivity(value); }
         }
 
+        /// <summary>
+        /// Determines is idle mode enabled. In idle mode editor windows that don't have focus and have no pending changes
+        /// skip their update, and the editor is throttled to <see cref="IdleFPSLimit"/> when no window needs updating.
+        /// </summary>
+        public static bool IdleModeEnabled
+        {
+            get { return Internal_GetIdleModeEnabled(); }
+            set { Internal_SetIdleModeEnabled(value); }
+        }
+
+        /// <summary>
+        /// Maximum number of frames per second the editor is allowed to execute while idle. Zero means infinite.
+        /// </summary>
+        public static int IdleFPSLimit
+        {
+            get { return Internal_GetIdleFPSLimit(); }
+            set { Internal_SetIdleFPSLimit(value); }
+        }
+
         /// <summary>
         /// Contains the absolute path to the last open project, if any.
         /// </summary>
@@ -373,6 +392,16 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetMouseSensitivity(float value);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetIdleModeEnabled();
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetIdleModeEnabled(bool value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetIdleFPSLimit();
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetIdleFPSLimit(int value);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern string Internal_GetLastOpenProject();
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -0,0 +1,154 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using bs;
+
+namespace bs.Editor
+{
+    /** @addtogroup Windows
+     *  @{
+     */
+
+    /// <summary>
+    /// Editor window that displays the commands in the global undo/redo stack that use the most memory, along with their
+    /// type and timings. Useful for finding tools that record more data than their changes require.
+    /// </summary>
+    internal class UndoRedoWindow : EditorWindow
+    {
+        private const int TITLE_HEIGHT = 21;
+        private const int COLUMN_WIDTH = 90;
+        private const int TYPE_COLUMN_WIDTH = 200;
+        private const int MAX_ENTRIES = 100;
+
+        private GUILabel totalLabel;
+        private GUIScrollArea commandsArea;
+        private bool isDirty;
+
+        /// <summary>
+        /// Opens the undo/redo profiling window.
+        /// </summary>
+        [MenuItem("Windows/Undo Redo Stack", 6000)]
+        private static void OpenUndoRedoWindow()
+        {
+            OpenWindow<UndoRedoWindow>();
+        }
+
+        /// <inheritdoc/>
+        protected override LocString GetDisplayName()
+        {
+            return new LocEdString("Undo/Redo Stack");
+        }
+
+        private void OnInitialize()
+        {
+            GUILayoutY layout = GUI.AddLayoutY();
+            GUILayoutX titleLayout = layout.AddLayoutX();
+
+            totalLabel = new GUILabel("", GUIOption.FixedHeight(TITLE_HEIGHT));
+            GUIButton refreshBtn = new GUIButton(new LocEdString("Refresh"), GUIOption.FixedHeight(TITLE_HEIGHT));
+
+            titleLayout.AddElement(totalLabel);
+            titleLayout.AddFlexibleSpace();
+            titleLayout.AddElement(refreshBtn);
+
+            refreshBtn.OnClick += Refresh;
+
+            commandsArea = new GUIScrollArea();
+            layout.AddElement(commandsArea);
+
+            UndoRedo.OnGlobalStackChanged += OnStackChanged;
+            Refresh();
+        }
+
+        private void OnDestroy()
+        {
+            UndoRedo.OnGlobalStackChanged -= OnStackChanged;
+        }
+
+        private void OnEditorUpdate()
+        {
+            if (!isDirty)
+                return;
+
+            Refresh();
+        }
+
+        /// <summary>
+        /// Triggered when the global undo/redo stack changes. Rebuilds the GUI on the next update, so that many changes
+        /// during a single frame only rebuild it once.
+        /// </summary>
+        private void OnStackChanged()
+        {
+            isDirty = true;
+        }
+
+        /// <summary>
+        /// Rebuilds the GUI displaying the commands, sorted by their memory usage.
+        /// </summary>
+        private void Refresh()
+        {
+            isDirty = false;
+            commandsArea.Layout.Clear();
+
+            UndoRedoCommandInfo[] commands = UndoRedo.Global.Commands;
+            Array.Sort(commands, (x, y) => y.memoryUsage.CompareTo(x.memoryUsage));
+
+            ulong totalMemory = 0;
+            for (int i = 0; i < commands.Length; i++)
+                totalMemory += commands[i].memoryUsage;
+
+            totalLabel.SetContent("Commands: " + commands.Length + ", Total size: " + FormatSize(totalMemory));
+
+            AddRow(new LocEdString("Type"), new LocEdString("Description"), new LocEdString("Size"),
+                new LocEdString("Undo (ms)"), new LocEdString("Redo (ms)"), new LocEdString("Stack"));
+
+            int numEntries = Math.Min(commands.Length, MAX_ENTRIES);
+            for (int i = 0; i < numEntries; i++)
+            {
+                AddRow(new LocEdString(commands[i].type),
+                    new LocEdString(commands[i].description),
+                    new LocEdString(FormatSize(commands[i].memoryUsage)),
+                    new LocEdString(commands[i].lastRevertTime.ToString("F3")),
+                    new LocEdString(commands[i].lastCommitTime.ToString("F3")),
+                    new LocEdString(commands[i].isRedo ? "Redo" : "Undo"));
+            }
+
+            commandsArea.Layout.AddFlexibleSpace();
+        }
+
+        /// <summary>
+        /// Adds a new row to the commands table.
+        /// </summary>
+        /// <param name="type">Type of the command the row belongs to.</param>
+        /// <param name="description">Description of the command the row belongs to.</param>
+        /// <param name="values">Values to display in the remaining columns.</param>
+        private void AddRow(LocString type, LocString description, params LocString[] values)
+        {
+            GUILayoutX rowLayout = commandsArea.Layout.AddLayoutX();
+            rowLayout.AddSpace(5);
+            rowLayout.AddElement(new GUILabel(type, GUIOption.FixedWidth(TYPE_COLUMN_WIDTH)));
+            rowLayout.AddElement(new GUILabel(description, GUIOption.FlexibleWidth()));
+
+            for (int i = 0; i < values.Length; i++)
+                rowLayout.AddElement(new GUILabel(values[i], GUIOption.FixedWidth(COLUMN_WIDTH)));
+        }
+
+        /// <summary>
+        /// Converts a size in bytes into a human readable string.
+        /// </summary>
+        /// <param name="bytes">Size to convert, in bytes.</param>
+        /// <returns>Size formatted in the largest unit that keeps the value above one.</returns>
+        private static string FormatSize(ulong bytes)
+        {
+            if (bytes >= 1024 * 1024)
+                return (bytes / (1024.0f * 1024.0f)).ToString("F2") + " MB";
+
+            if (bytes >= 1024)
+                return (bytes / 1024.0f).ToString("F2") + " KB";
+
+            return bytes + " B";
+        }
+    }
+
+    /** @} */
+}
@@ -28,6 +28,10 @@
 #include "Wrappers/BsScriptUndoRedo.h"
 #include "BsEditorScriptLibrary.h"
 #include "Generated/BsScriptPlayInEditor.generated.h"
+#include "EditorWindow/BsEditorWindowManager.h"
+#include "EditorWindow/BsEditorWidgetProfiler.h"
+#include "Scene/BsSceneChangeNotifier.h"
+#include <mono/metadata/mono-gc.h>
 
 namespace bs
 {
@@ -57,6 +61,8 @@ namespace bs
 		ScriptInspectorUtility::startUp();
 		ScriptPlayInEditor::startUp();
 
+		EditorWidgetProfiler::instance().setGCMemoryCallback([]() { return (UINT64)mono_gc_get_used_size(); });
+
 		mOnDomainLoadConn = ScriptObjectManager::instance().onRefreshDomainLoaded.connect(std::bind(&EditorScriptManager::loadMonoTypes, this));
 		mOnAssemblyRefreshDoneConn = ScriptObjectManager::instance().onRefreshComplete.connect(std::bind(&EditorScriptManager::onAssemblyRefreshDone, this));
 		triggerOnInitialize();
@@ -75,6 +81,8 @@ namespace bs
 		mOnDomainLoadConn.disconnect();
 		mOnAssemblyRefreshDoneConn.disconnect();
 
+		EditorWidgetProfiler::instance().setGCMemoryCallback(nullptr);
+
 		ScriptPlayInEditor::shutDown();
 		ScriptInspectorUtility::shutDown();
 		ScriptSelection::shutDown();
@@ -108,6 +116,19 @@ namespace bs
 		ScriptDragDropManager::instance().update();
 		ScriptFolderMonitorManager::instance().update();
 		ScriptEditorApplication::update();
+
+		// The scene changes every frame while in play mode, keep all windows up to date even in idle mode
+		PlayInEditorState playState = PlayInEditor::instance().getState();
+		if (playState == PlayInEditorState::Playing)
+			EditorWindowManager::instance().markAllDirty();
+
+		// Objects modified by the game aren't reported individually. Also report the scene being restored when play
+		// mode ends.
+		bool isStopped = playState == PlayInEditorState::Stopped;
+		if (!isStopped || !mWasStopped)
+			SceneChangeNotifier::instance().notifySceneChanged();
+
+		mWasStopped = isStopped;
 	}
 
 	void EditorScriptManager::quitRequested()
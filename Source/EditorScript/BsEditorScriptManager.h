@@ -52,6 +52,7 @@ namespace bs
 
 		HEvent mOnDomainLoadConn;
 		HEvent mOnAssemblyRefreshDoneConn;
+		bool mWasStopped = true;
 	};
 
 	/** @} */
@@ -10,11 +10,14 @@
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Serialization/BsMemorySerializer.h"
 #include "Serialization/BsManagedSerializableObject.h"
+#include "UndoRedo/BsUndoRedo.h"
 
 namespace bs
 {
 	MonoMethod* ScriptCmdManaged::sCommitMethod = nullptr;
 	MonoMethod* ScriptCmdManaged::sRevertMethod = nullptr;
+	MonoMethod* ScriptCmdManaged::sGetMemoryUsageMethod = nullptr;
+	MonoMethod* ScriptCmdManaged::sOnColdMethod = nullptr;
 
 	ScriptCmdManaged::ScriptCmdManaged(MonoObject* managedInstance)
 		:ScriptObject(managedInstance)
@@ -27,7 +30,7 @@ namespace bs
 				"able to persist assembly refresh.");
 		}
 
-		mManagedCommand = bs_shared_ptr(new (bs_alloc<CmdManaged>()) CmdManaged(this));
+		mManagedCommand = UndoRedo::instance().getActiveArena().newShared<CmdManaged>(this);
 
 		mGCHandle = MonoUtil::newWeakGCHandle(managedInstance);
 		mInUndoRedoStack = false;
@@ -48,6 +51,8 @@ namespace bs
 
 		sCommitMethod = metaData.scriptClass->getMethod("Commit");
 		sRevertMethod = metaData.scriptClass->getMethod("Revert");
+		sGetMemoryUsageMethod = metaData.scriptClass->getMethod("GetMemoryUsage");
+		sOnColdMethod = metaData.scriptClass->getMethod("OnCold", 1);
 	}
 
 	void ScriptCmdManaged::internal_CreateInstance(MonoObject* managedInstance)
@@ -73,6 +78,32 @@ namespace bs
 		sRevertMethod->invokeVirtual(obj, nullptr);
 	}
 
+	UINT64 ScriptCmdManaged::triggerGetMemoryUsage() const
+	{
+		if (sGetMemoryUsageMethod == nullptr || mGCHandle == 0)
+			return 0;
+
+		MonoObject* obj = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		if (obj == nullptr)
+			return 0;
+
+		MonoObject* result = sGetMemoryUsageMethod->invokeVirtual(obj, nullptr);
+		return *(UINT64*)MonoUtil::unbox(result);
+	}
+
+	void ScriptCmdManaged::triggerCold(bool spillToDisk)
+	{
+		if (sOnColdMethod == nullptr || mGCHandle == 0)
+			return;
+
+		MonoObject* obj = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		if (obj == nullptr)
+			return;
+
+		void* params[1] = { &spillToDisk };
+		sOnColdMethod->invokeVirtual(obj, params);
+	}
+
 	void ScriptCmdManaged::notifyCommandDestroyed()
 	{
 		mManagedCommand = nullptr;
@@ -236,6 +267,32 @@ namespace bs
 		mScriptObj->triggerRevert();
 	}
 
+	UINT64 CmdManaged::getMemoryUsage() const
+	{
+		UINT64 usage = EditorCommand::getMemoryUsage();
+		if (mScriptObj != nullptr)
+			usage += mScriptObj->triggerGetMemoryUsage();
+
+		return usage;
+	}
+
+	String CmdManaged::getTypeName() const
+	{
+		if (mScriptObj == nullptr)
+			return "CmdManaged";
+
+		if (mScriptObj->mNamespace.empty())
+			return mScriptObj->mType;
+
+		return mScriptObj->mNamespace + "." + mScriptObj->mType;
+	}
+
+	void CmdManaged::onCommandCold(bool spillToDisk)
+	{
+		if (mScriptObj != nullptr)
+			mScriptObj->triggerCold(spillToDisk);
+	}
+
 	void CmdManaged::onCommandAdded()
 	{
 		if(mScriptObj)
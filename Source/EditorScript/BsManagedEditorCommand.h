@@ -36,6 +36,12 @@ namespace bs
 		/** Triggers the Revert() method on the managed object instance. */
 		void triggerRevert();
 
+		/** Triggers the GetMemoryUsage() method on the managed object instance and returns its result. */
+		UINT64 triggerGetMemoryUsage() const;
+
+		/** Triggers the OnCold() method on the managed object instance. */
+		void triggerCold(bool spillToDisk);
+
 		/**
 		 * Allocates a GC handle that ensures the object doesn't get GC collected. Must eventually be followed by
 		 * freeGCHandle().
@@ -81,6 +87,8 @@ namespace bs
 
 		static MonoMethod* sCommitMethod;
 		static MonoMethod* sRevertMethod;
+		static MonoMethod* sGetMemoryUsageMethod;
+		static MonoMethod* sOnColdMethod;
 	};
 
 	/** @} */
@@ -104,8 +112,15 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getMemoryUsage */
+		UINT64 getMemoryUsage() const override;
+
+		/** @copydoc EditorCommand::getTypeName */
+		String getTypeName() const override;
+
 	private:
 		friend class UndoRedo;
+		friend class UndoRedoArena;
 		friend class ScriptCmdManaged;
 
 		CmdManaged(ScriptCmdManaged* scriptObj);
@@ -116,6 +131,9 @@ namespace bs
 		/** @copydoc EditorCommand::commit */
 		void onCommandRemoved() override;
 
+		/** @copydoc EditorCommand::onCommandCold */
+		void onCommandCold(bool spillToDisk) override;
+
 		/** 
 		 * Notifies the command the managed script object instance it is referencing has been destroyed. Normally when this
 		 * happens the command should already be outside of the undo/redo stack, but we clear the instance just in case.
@@ -17,6 +17,8 @@
 #include "BsScriptGameObjectManager.h"
 #include "Wrappers/BsScriptComponent.h"
 #include "Wrappers/BsScriptSelection.h"
+#include "Reflection/BsRTTIType.h"
+#include "Scene/BsSceneChangeNotifier.h"
 
 using namespace std::placeholders;
 
@@ -30,6 +32,10 @@ namespace bs
 			[this](const Vector<HSceneObject>& objects) { onSOSelectionChanged(objects, true); });
 		mSelectionSORemovedConn = Selection::instance().onSceneObjectsRemoved.connect(
 			[this](const Vector<HSceneObject>& objects) { onSOSelectionChanged(objects, false); });
+		mObjectChangedConn = SceneChangeNotifier::instance().onObjectChanged.connect(
+			std::bind(&ScriptGizmoManager::onObjectChanged, this, _1));
+		mSceneChangedConn = SceneChangeNotifier::instance().onSceneChanged.connect(
+			std::bind(&ScriptGizmoManager::onSceneChanged, this));
 
 		reloadAssemblyData();
 	}
@@ -38,6 +44,8 @@ namespace bs
 	{
 		mSelectionSOAddedConn.disconnect();
 		mSelectionSORemovedConn.disconnect();
+		mObjectChangedConn.disconnect();
+		mSceneChangedConn.disconnect();
 		mDomainLoadedConn.disconnect();
 	}
 
@@ -45,98 +53,139 @@ namespace bs
 	{
 		GizmoManager::instance().clearGizmos();
 
-		HSceneObject rootSO = SceneManager::instance().getMainScene()->getRoot();
+		updateGizmoComponents();
 
-		Stack<HSceneObject> todo;
-		todo.push(rootSO);
-
-		bool isParentSelected = false;
-		UINT32 parentSelectedPopIdx = 0;
-		
-		Vector<HSceneObject> selectedObjects = Selection::instance().getSceneObjects();
-
-		while (!todo.empty())
+		UnorderedSet<UINT64> selectedObjects;
+		for (auto& so : Selection::instance().getSceneObjects())
 		{
-			if (isParentSelected && parentSelectedPopIdx == (UINT32)todo.size())
-			{
-				isParentSelected = false;
-			}
+			if (!so.isDestroyed())
+				selectedObjects.insert(so->getInstanceId());
+		}
 
-			HSceneObject curSO = todo.top();
-			todo.pop();
+		for (auto& gizmoComponent : mGizmoComponents)
+		{
+			if (gizmoComponent.component.isDestroyed())
+				continue;
 
-			if(curSO->hasFlag(SOF_Internal))
+			MonoObject* managedInstance = nullptr;
+			const SmallVector<GizmoData, 2>* entries = getGizmoDrawers(gizmoComponent.component, managedInstance);
+			if (entries == nullptr)
 				continue;
 
-			bool isSelected = std::count(selectedObjects.begin(), selectedObjects.end(), curSO) > 0;
-			if (isSelected && !isParentSelected)
+			const HSceneObject& curSO = gizmoComponent.sceneObject;
+			bool isSelected = selectedObjects.find(curSO->getInstanceId()) != selectedObjects.end();
+
+			bool isParentSelected = isSelected;
+			HSceneObject parent = curSO->getParent();
+			while (!isParentSelected && parent != nullptr)
 			{
-				isParentSelected = true;
-				parentSelectedPopIdx = (UINT32)todo.size();
+				isParentSelected = selectedObjects.find(parent->getInstanceId()) != selectedObjects.end();
+				parent = parent->getParent();
 			}
 
-			const Vector<HComponent>& components = curSO->getComponents();
-			for (auto& component : components)
+			for(auto& entry : *entries)
 			{
-				String componentName;
-				MonoObject* managedInstance = nullptr;
-				if (rtti_is_of_type<ManagedComponent>(component.get()))
+				UINT32 flags = entry.flags;
+
+				bool drawGizmo = false;
+				if (((flags & (UINT32)DrawGizmoFlags::Selected) != 0) && isSelected)
+					drawGizmo = true;
+
+				if (((flags & (UINT32)DrawGizmoFlags::ParentSelected) != 0) && isParentSelected)
+					drawGizmo = true;
+
+				if (((flags & (UINT32)DrawGizmoFlags::NotSelected) != 0) && !isSelected && !isParentSelected)
+					drawGizmo = true;
+
+				if (drawGizmo)
 				{
-					ManagedComponent* managedComponent = static_cast<ManagedComponent*>(component.get());
-					componentName = managedComponent->getManagedFullTypeName();
-					managedInstance = managedComponent->getManagedInstance();
+					bool pickable = (flags & (UINT32)DrawGizmoFlags::Pickable) != 0;
+					GizmoManager::instance().startGizmo(curSO);
+					GizmoManager::instance().setPickable(pickable);
+
+					void* params[1] = { managedInstance };
+					entry.method->invoke(nullptr, params);
+
+					GizmoManager::instance().endGizmo();
 				}
-				else
-				{
-					ScriptGameObjectManager& sgoManager = ScriptGameObjectManager::instance();
-					ScriptComponentBase* scriptComponent = sgoManager.getBuiltinScriptComponent(component);
+			}
+		}
+	}
 
-					if (scriptComponent)
-					{
-						managedInstance = scriptComponent->getManagedInstance();
+	void ScriptGizmoManager::updateGizmoComponents()
+	{
+		if (mRebuildGizmoComponents)
+		{
+			mRebuildGizmoComponents = false;
+			mDirtyObjects.clear();
+			mGizmoComponents.clear();
 
-						String ns, typeName;
-						MonoUtil::getClassName(managedInstance, ns, typeName);
+			findGizmoComponents(SceneManager::instance().getMainScene()->getRoot());
+			return;
+		}
 
-						componentName = ns + "." + typeName;
-					}
-				}
+		for (auto& dirtyEntry : mDirtyObjects)
+		{
+			const HSceneObject& dirtySO = dirtyEntry.second;
+			if (dirtySO.isDestroyed())
+				continue;
 
-				if (componentName.empty())
-					continue;
+			// Remove existing entries from the modified hierarchy (and any destroyed ones), then search it again
+			UINT64 dirtyId = dirtySO->getInstanceId();
+			auto iterRemove = std::remove_if(mGizmoComponents.begin(), mGizmoComponents.end(),
+				[dirtyId](const GizmoComponent& entry)
+			{
+				if (entry.component.isDestroyed())
+					return true;
 
-				auto iterFind = mGizmoDrawers.find(componentName);
-				if (iterFind != mGizmoDrawers.end())
+				HSceneObject so = entry.sceneObject;
+				while (so != nullptr)
 				{
-					SmallVector<GizmoData, 2>& entries = iterFind->second;
+					if (so->getInstanceId() == dirtyId)
+						return true;
 
-					for(auto& entry : entries)
-					{
-						UINT32 flags = entry.flags;
+					so = so->getParent();
+				}
 
-						bool drawGizmo = false;
-						if (((flags & (UINT32)DrawGizmoFlags::Selected) != 0) && isSelected)
-							drawGizmo = true;
+				return false;
+			});
 
-						if (((flags & (UINT32)DrawGizmoFlags::ParentSelected) != 0) && isParentSelected)
-							drawGizmo = true;
+			mGizmoComponents.erase(iterRemove, mGizmoComponents.end());
+
+			bool isInternal = false;
+			HSceneObject so = dirtySO;
+			while (so != nullptr && !isInternal)
+			{
+				isInternal = so->hasFlag(SOF_Internal);
+				so = so->getParent();
+			}
 
-						if (((flags & (UINT32)DrawGizmoFlags::NotSelected) != 0) && !isSelected && !isParentSelected)
-							drawGizmo = true;
+			if (!isInternal)
+				findGizmoComponents(dirtySO);
+		}
 
-						if (drawGizmo)
-						{
-							bool pickable = (flags & (UINT32)DrawGizmoFlags::Pickable) != 0;
-							GizmoManager::instance().startGizmo(curSO);
-							GizmoManager::instance().setPickable(pickable);
+		mDirtyObjects.clear();
+	}
 
-							void* params[1] = { managedInstance };
-							entry.method->invoke(nullptr, params);
+	void ScriptGizmoManager::findGizmoComponents(const HSceneObject& root)
+	{
+		Stack<HSceneObject> todo;
+		todo.push(root);
 
-							GizmoManager::instance().endGizmo();
-						}
-					}
-				}
+		while (!todo.empty())
+		{
+			HSceneObject curSO = todo.top();
+			todo.pop();
+
+			if(curSO->hasFlag(SOF_Internal))
+				continue;
+
+			const Vector<HComponent>& components = curSO->getComponents();
+			for (auto& component : components)
+			{
+				MonoObject* managedInstance = nullptr;
+				if (getGizmoDrawers(component, managedInstance) != nullptr)
+					mGizmoComponents.push_back({ curSO, component });
 			}
 
 			for (UINT32 i = 0; i < curSO->getNumChildren(); i++)
@@ -144,6 +193,18 @@ namespace bs
 		}
 	}
 
+	void ScriptGizmoManager::onObjectChanged(const HSceneObject& sceneObject)
+	{
+		if (!mRebuildGizmoComponents)
+			mDirtyObjects[sceneObject->getInstanceId()] = sceneObject;
+	}
+
+	void ScriptGizmoManager::onSceneChanged()
+	{
+		mRebuildGizmoComponents = true;
+		mDirtyObjects.clear();
+	}
+
 	void ScriptGizmoManager::reloadAssemblyData()
 	{
 		// Reload DrawGizmo attribute from editor assembly
@@ -159,6 +220,9 @@ namespace bs
 			BS_EXCEPT(InvalidStateException, "Cannot find OnSelectionChanged managed class.");
 
 		mGizmoDrawers.clear();
+		mBuiltinGizmoDrawers.clear();
+		mSelectionChangedCallbacks.clear();
+		mRebuildGizmoComponents = true;
 
 		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
 		for (auto& assemblyName : scriptAssemblyNames)
@@ -242,6 +306,59 @@ namespace bs
 		}
 	}
 
+	const SmallVector<ScriptGizmoManager::GizmoData, 2>* ScriptGizmoManager::getGizmoDrawers(const HComponent& component,
+		MonoObject*& managedInstance)
+	{
+		if (rtti_is_of_type<ManagedComponent>(component.get()))
+		{
+			ManagedComponent* managedComponent = static_cast<ManagedComponent*>(component.get());
+
+			auto iterFind = mGizmoDrawers.find(managedComponent->getManagedFullTypeName());
+			if (iterFind == mGizmoDrawers.end())
+				return nullptr;
+
+			managedInstance = managedComponent->getManagedInstance();
+			return &iterFind->second;
+		}
+
+		UINT32 typeId = component->getRTTI()->getRTTIId();
+		ScriptGameObjectManager& sgoManager = ScriptGameObjectManager::instance();
+
+		auto iterFind = mBuiltinGizmoDrawers.find(typeId);
+		if (iterFind != mBuiltinGizmoDrawers.end())
+		{
+			// Only retrieve the script component if there's something to draw
+			if (iterFind->second == nullptr)
+				return nullptr;
+
+			ScriptComponentBase* scriptComponent = sgoManager.getBuiltinScriptComponent(component);
+			if (scriptComponent == nullptr)
+				return nullptr;
+
+			managedInstance = scriptComponent->getManagedInstance();
+			return iterFind->second;
+		}
+
+		// First time encountering this type, resolve its managed type name. If the managed type can't be determined
+		// right now, don't remember the miss so it can be looked up again later.
+		ScriptComponentBase* scriptComponent = sgoManager.getBuiltinScriptComponent(component);
+		if (scriptComponent == nullptr)
+			return nullptr;
+
+		managedInstance = scriptComponent->getManagedInstance();
+
+		String ns, typeName;
+		MonoUtil::getClassName(managedInstance, ns, typeName);
+
+		const SmallVector<GizmoData, 2>* entries = nullptr;
+		auto iterFindDrawers = mGizmoDrawers.find(ns + "." + typeName);
+		if (iterFindDrawers != mGizmoDrawers.end())
+			entries = &iterFindDrawers->second;
+
+		mBuiltinGizmoDrawers[typeId] = entries;
+		return entries;
+	}
+
 	bool ScriptGizmoManager::isValidDrawGizmoMethod(MonoMethod* method, MonoClass*& componentType, UINT32& drawGizmoFlags)
 	{
 		componentType = nullptr;
@@ -33,6 +33,13 @@ namespace bs
 			UINT32 flags; /**< Gizmo flags of type DrawGizmoFlags that control gizmo properties. */
 		};
 
+		/** Component with at least one gizmo draw method, found in the scene. */
+		struct GizmoComponent
+		{
+			HSceneObject sceneObject;
+			HComponent component;
+		};
+
 		/** Data about a managed selection changed callback method. */
 		struct SelectionChangedData
 		{
@@ -46,6 +53,8 @@ namespace bs
 
 		/**
 		 * Iterates over all managed gizmos, calls their draw methods and registers the gizmos with the native GizmoManager.
+		 * The scene is only searched for components with gizmos when a modification is reported through 
+		 * SceneChangeNotifier.
 		 */
 		void update();
 
@@ -62,6 +71,36 @@ namespace bs
 		 */
 		void onSOSelectionChanged(const Vector<HSceneObject>& sceneObjects, bool added);
 
+		/** 
+		 * Updates the list of scene components with gizmo draw methods, according to the scene modifications reported
+		 * since the last call. 
+		 */
+		void updateGizmoComponents();
+
+		/** 
+		 * Finds all components with gizmo draw methods in the provided hierarchy and adds them to the gizmo component
+		 * list. Hierarchies of internal scene objects are skipped.
+		 */
+		void findGizmoComponents(const HSceneObject& root);
+
+		/** Triggered by SceneChangeNotifier when a specific scene object was modified. */
+		void onObjectChanged(const HSceneObject& sceneObject);
+
+		/** Triggered by SceneChangeNotifier when any part of the scene might have been modified. */
+		void onSceneChanged();
+
+		/**
+		 * Finds all gizmo draw methods registered for the type of the provided component. Lookups for builtin component
+		 * types are cached per RTTI type, so their managed type names only need to be resolved once. Types whose managed
+		 * type couldn't be resolved aren't cached, and are looked up again on the next call.
+		 *
+		 * @param[in]	component		Component to find the gizmo draw methods for.
+		 * @param[out]	managedInstance	Managed instance of the component, to pass to the draw methods. Only valid if this
+		 *								method returns a non-null value.
+		 * @return						List of gizmo draw methods, or null if the component type has none.
+		 */
+		const SmallVector<GizmoData, 2>* getGizmoDrawers(const HComponent& component, MonoObject*& managedInstance);
+
 		/**
 		 * Checks is the provided method a valid gizmo draw method and if it is, returns properties of that method.
 		 *
@@ -88,12 +127,19 @@ namespace bs
 		HEvent mDomainLoadedConn;
 		HEvent mSelectionSOAddedConn;
 		HEvent mSelectionSORemovedConn;
+		HEvent mObjectChangedConn;
+		HEvent mSceneChangedConn;
 
 		MonoClass* mDrawGizmoAttribute = nullptr;
 		MonoField* mFlagsField = nullptr;
 		MonoClass* mOnSelectionChangedAttribute = nullptr;
 		UnorderedMap<String, SmallVector<GizmoData, 2>> mGizmoDrawers;
+		UnorderedMap<UINT32, const SmallVector<GizmoData, 2>*> mBuiltinGizmoDrawers;
 		Map<String, SelectionChangedData> mSelectionChangedCallbacks;
+
+		Vector<GizmoComponent> mGizmoComponents;
+		UnorderedMap<UINT64, HSceneObject> mDirtyObjects;
+		bool mRebuildGizmoComponents = true;
 	};
 
 	/** @} */
@@ -40,6 +40,7 @@ set(BS_EDITORSCRIPT_SRC_WRAPPERS
 	"Wrappers/BsScriptEditorTestSuite.cpp"
 	"Wrappers/BsScriptEditorUtility.cpp"
 	"Wrappers/BsScriptEditorVirtualInput.cpp"
+	"Wrappers/BsScriptEditorWidgetProfiler.cpp"
 	"Wrappers/BsScriptEditorWindow.cpp"
 	"Wrappers/BsScriptFolderMonitor.cpp"
 	"Wrappers/BsScriptGizmos.cpp"
@@ -94,6 +95,7 @@ set(BS_EDITORSCRIPT_INC_WRAPPERS
 	"Wrappers/BsScriptEditorTestSuite.h"
 	"Wrappers/BsScriptEditorUtility.h"
 	"Wrappers/BsScriptEditorVirtualInput.h"
+	"Wrappers/BsScriptEditorWidgetProfiler.h"
 	"Wrappers/BsScriptEditorWindow.h"
 	"Wrappers/BsScriptFolderMonitor.h"
 	"Wrappers/BsScriptGizmos.h"
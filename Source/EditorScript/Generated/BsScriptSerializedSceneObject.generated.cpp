@@ -19,6 +19,8 @@ namespace bs
 	{
 		metaData.scriptClass->addInternalCall("Internal_SerializedSceneObject", (void*)&ScriptSerializedSceneObject::Internal_SerializedSceneObject);
 		metaData.scriptClass->addInternalCall("Internal_restore", (void*)&ScriptSerializedSceneObject::Internal_restore);
+		metaData.scriptClass->addInternalCall("Internal_getMemoryUsage", (void*)&ScriptSerializedSceneObject::Internal_getMemoryUsage);
+		metaData.scriptClass->addInternalCall("Internal_compress", (void*)&ScriptSerializedSceneObject::Internal_compress);
 
 	}
 
@@ -48,4 +50,20 @@ namespace bs
 	{
 		thisPtr->getInternal()->restore();
 	}
+
+	uint64_t ScriptSerializedSceneObject::Internal_getMemoryUsage(ScriptSerializedSceneObject* thisPtr)
+	{
+		uint64_t tmp__output;
+		tmp__output = thisPtr->getInternal()->getMemoryUsage();
+
+		uint64_t __output;
+		__output = tmp__output;
+
+		return __output;
+	}
+
+	void ScriptSerializedSceneObject::Internal_compress(ScriptSerializedSceneObject* thisPtr, bool spillToDisk)
+	{
+		thisPtr->getInternal()->compress(spillToDisk);
+	}
 }
@@ -24,5 +24,7 @@ namespace bs
 
 		static void Internal_SerializedSceneObject(MonoObject* managedInstance, MonoObject* sceneObject, bool hierarchy);
 		static void Internal_restore(ScriptSerializedSceneObject* thisPtr);
+		static uint64_t Internal_getMemoryUsage(ScriptSerializedSceneObject* thisPtr);
+		static void Internal_compress(ScriptSerializedSceneObject* thisPtr, bool spillToDisk);
 	};
 }
@@ -334,7 +334,36 @@ namespace bs
 				bool reload = gResources().isLoaded(uuid);
 
 				HPrefab prefab = static_resource_cast<Prefab>(gProjectLibrary().load(sourcePath));
-				prefab->_updateChildInstances();
+
+				// Only prefabs with other prefabs nested in them need updating
+				bool hasChildInstances = false;
+				{
+					Stack<HSceneObject> todo;
+					HSceneObject root = prefab->_getRoot();
+
+					UINT32 numChildren = root->getNumChildren();
+					for (UINT32 i = 0; i < numChildren; i++)
+						todo.push(root->getChild(i));
+
+					while (!todo.empty())
+					{
+						HSceneObject current = todo.top();
+						todo.pop();
+
+						if (!current->getPrefabLink(true).empty())
+						{
+							hasChildInstances = true;
+							break;
+						}
+
+						numChildren = current->getNumChildren();
+						for (UINT32 i = 0; i < numChildren; i++)
+							todo.push(current->getChild(i));
+					}
+				}
+
+				if (hasChildInstances)
+					prefab->_updateChildInstances();
 
 				// Clear prefab diffs as they're not used in standalone
 				Stack<HSceneObject> todo;
@@ -5,6 +5,7 @@
 #include "BsMonoClass.h"
 #include "BsMonoMethod.h"
 #include "BsMonoUtil.h"
+#include "BsMonoArray.h"
 #include "BsEditorApplication.h"
 #include "Library/BsProjectLibrary.h"
 #include "Library/BsProjectResourceMeta.h"
@@ -25,6 +26,12 @@
 
 #include "Generated/BsScriptRenderTexture.generated.h"
 #include "BsEditorScriptLibrary.h"
+#include "Wrappers/BsScriptSceneObject.h"
+#include "Scene/BsSceneChangeNotifier.h"
+#include "Testing/BsSceneViewBenchmark.h"
+#include "BsScriptGizmoManager.h"
+#include "Components/BsCCamera.h"
+#include "RenderAPI/BsViewport.h"
 
 namespace bs
 {
@@ -72,6 +79,8 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_ToggleToolbarItem", (void*)&ScriptEditorApplication::internal_ToggleToolbarItem);
 		metaData.scriptClass->addInternalCall("Internal_SetMainRenderTarget", (void*)&ScriptEditorApplication::internal_SetMainRenderTarget);
 		metaData.scriptClass->addInternalCall("Internal_HasFocus", (void*)&ScriptEditorApplication::internal_HasFocus);
+		metaData.scriptClass->addInternalCall("Internal_NotifySceneModified", (void*)&ScriptEditorApplication::internal_NotifySceneModified);
+		metaData.scriptClass->addInternalCall("Internal_RunSceneViewBenchmark", (void*)&ScriptEditorApplication::internal_RunSceneViewBenchmark);
 
 		onProjectLoadedThunk = (OnProjectLoadedThunkDef)metaData.scriptClass->getMethod("Internal_OnProjectLoaded")->getThunk();
 		onStatusBarClickedThunk = (OnStatusBarClickedThunkDef)metaData.scriptClass->getMethod("Internal_OnStatusBarClicked")->getThunk();
@@ -239,7 +248,9 @@ namespace bs
 			scene = static_resource_cast<Prefab>(gProjectLibrary().load(nativePath));
 			scene->update(sceneRoot);
 
-			gProjectLibrary().saveEntry(scene);
+			// Prefab now holds its own copy of the scene, so it can be encoded and written on a worker. The next save
+			// loads it through the library first, which waits for this write to finish.
+			gProjectLibrary().saveEntry(scene, false);
 		}
 		else
 		{
@@ -331,4 +342,52 @@ namespace bs
 	{
 		return EditorWindowManager::instance().hasFocus();
 	}
+
+	void ScriptEditorApplication::internal_NotifySceneModified(MonoArray* modifiedObjects)
+	{
+		if (modifiedObjects == nullptr)
+		{
+			SceneChangeNotifier::instance().notifySceneChanged();
+			return;
+		}
+
+		ScriptArray scriptArray(modifiedObjects);
+
+		UINT32 arrayLen = scriptArray.size();
+		for (UINT32 i = 0; i < arrayLen; i++)
+		{
+			MonoObject* monoSO = scriptArray.get<MonoObject*>(i);
+			ScriptSceneObject* scriptSO = ScriptSceneObject::toNative(monoSO);
+
+			if (scriptSO == nullptr)
+				continue;
+
+			HSceneObject so = static_object_cast<SceneObject>(scriptSO->getNativeHandle());
+			SceneChangeNotifier::instance().notifyObjectChanged(so);
+		}
+	}
+
+	void ScriptEditorApplication::internal_RunSceneViewBenchmark(MonoString* outputPath)
+	{
+		Path nativePath = MonoUtil::monoToString(outputPath);
+
+		SceneViewBenchmarkDesc desc;
+
+		HSceneObject cameraSO = SceneObject::create("SceneViewBenchmarkCamera",
+			SOF_Internal | SOF_Persistent | SOF_DontSave);
+		cameraSO->setPosition(Vector3(0.0f, 0.0f, desc.sceneExtent));
+		cameraSO->lookAt(Vector3::ZERO);
+
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gCoreApplication().getPrimaryWindow());
+
+		{
+			SceneViewBenchmark benchmark(desc);
+			benchmark.setScriptGizmoCallback([]() { ScriptGizmoManager::instance().update(); });
+			benchmark.run(camera->_getCamera());
+			benchmark.saveJSON(nativePath);
+		}
+
+		cameraSO->destroy();
+	}
 }
@@ -75,6 +75,8 @@ namespace bs
 		static void internal_FrameStep();
 		static void internal_SetMainRenderTarget(ScriptRenderTarget* renderTarget);
 		static bool internal_HasFocus();
+		static void internal_NotifySceneModified(MonoArray* modifiedObjects);
+		static void internal_RunSceneViewBenchmark(MonoString* outputPath);
 
 		typedef void(BS_THUNKCALL *OnProjectLoadedThunkDef)(MonoException**);
 		typedef void(BS_THUNKCALL *OnStatusBarClickedThunkDef) (MonoException**);
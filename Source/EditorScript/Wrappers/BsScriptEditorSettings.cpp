@@ -39,6 +39,10 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_SetFPSLimit", (void*)&ScriptEditorSettings::internal_SetFPSLimit);
 		metaData.scriptClass->addInternalCall("Internal_GetMouseSensitivity", (void*)&ScriptEditorSettings::internal_GetMouseSensitivity);
 		metaData.scriptClass->addInternalCall("Internal_SetMouseSensitivity", (void*)&ScriptEditorSettings::internal_SetMouseSensitivity);
+		metaData.scriptClass->addInternalCall("Internal_GetIdleModeEnabled", (void*)&ScriptEditorSettings::internal_GetIdleModeEnabled);
+		metaData.scriptClass->addInternalCall("Internal_SetIdleModeEnabled", (void*)&ScriptEditorSettings::internal_SetIdleModeEnabled);
+		metaData.scriptClass->addInternalCall("Internal_GetIdleFPSLimit", (void*)&ScriptEditorSettings::internal_GetIdleFPSLimit);
+		metaData.scriptClass->addInternalCall("Internal_SetIdleFPSLimit", (void*)&ScriptEditorSettings::internal_SetIdleFPSLimit);
 		metaData.scriptClass->addInternalCall("Internal_GetLastOpenProject", (void*)&ScriptEditorSettings::internal_GetLastOpenProject);
 		metaData.scriptClass->addInternalCall("Internal_SetLastOpenProject", (void*)&ScriptEditorSettings::internal_SetLastOpenProject);
 		metaData.scriptClass->addInternalCall("Internal_GetAutoLoadLastProject", (void*)&ScriptEditorSettings::internal_GetAutoLoadLastProject);
@@ -182,6 +186,30 @@ namespace bs
 		settings->setMouseSensitivity(value);
 	}
 
+	bool ScriptEditorSettings::internal_GetIdleModeEnabled()
+	{
+		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
+		return settings->getIdleModeEnabled();
+	}
+
+	void ScriptEditorSettings::internal_SetIdleModeEnabled(bool value)
+	{
+		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
+		settings->setIdleModeEnabled(value);
+	}
+
+	UINT32 ScriptEditorSettings::internal_GetIdleFPSLimit()
+	{
+		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
+		return settings->getIdleFPSLimit();
+	}
+
+	void ScriptEditorSettings::internal_SetIdleFPSLimit(UINT32 value)
+	{
+		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
+		settings->setIdleFPSLimit(value);
+	}
+
 	MonoString* ScriptEditorSettings::internal_GetLastOpenProject()
 	{
 		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
@@ -43,6 +43,10 @@ namespace bs
 		static void internal_SetFPSLimit(UINT32 value);
 		static float internal_GetMouseSensitivity();
 		static void internal_SetMouseSensitivity(float value);
+		static bool internal_GetIdleModeEnabled();
+		static void internal_SetIdleModeEnabled(bool value);
+		static UINT32 internal_GetIdleFPSLimit();
+		static void internal_SetIdleFPSLimit(UINT32 value);
 
 		static MonoString* internal_GetLastOpenProject();
 		static void internal_SetLastOpenProject(MonoString* value);
@@ -24,6 +24,7 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_CalculateBounds", (void*)&ScriptEditorUtility::internal_CalculateBounds);
 		metaData.scriptClass->addInternalCall("Internal_CalculateBoundsArray", (void*)&ScriptEditorUtility::internal_CalculateBoundsArray);
 		metaData.scriptClass->addInternalCall("Internal_CalculateArrayCenter", (void*)&ScriptEditorUtility::internal_CalculateArrayCenter);
+		metaData.scriptClass->addInternalCall("Internal_CalculateHierarchyCenter", (void*)&ScriptEditorUtility::internal_CalculateHierarchyCenter);
 		metaData.scriptClass->addInternalCall("Internal_FindDependencies", (void*)&ScriptEditorUtility::internal_FindDependencies);
 		metaData.scriptClass->addInternalCall("Internal_IsInternal", (void*)&ScriptEditorUtility::internal_IsInternal);
 	}
@@ -99,6 +100,25 @@ namespace bs
 		*center = EditorUtility::calculateCenter(sceneObjects);
 	}
 
+	void ScriptEditorUtility::internal_CalculateHierarchyCenter(MonoArray* objects, Vector3* center)
+	{
+		Vector<HSceneObject> sceneObjects;
+
+		ScriptArray scriptArray(objects);
+		UINT32 arrayLen = scriptArray.size();
+		for (UINT32 i = 0; i < arrayLen; i++)
+		{
+			MonoObject* curObject = scriptArray.get<MonoObject*>(i);
+
+			ScriptSceneObject* scriptSO = ScriptSceneObject::toNative(curObject);
+
+			if (scriptSO != nullptr)
+				sceneObjects.push_back(static_object_cast<SceneObject>(scriptSO->getNativeHandle()));
+		}
+
+		*center = EditorUtility::calculateHierarchyCenter(sceneObjects);
+	}
+
 	bool ScriptEditorUtility::internal_IsInternal(ScriptSceneObject* soPtr)
 	{
 		if (ScriptSceneObject::checkIfDestroyed(soPtr))
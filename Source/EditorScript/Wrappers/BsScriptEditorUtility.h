@@ -28,6 +28,7 @@ namespace bs
 		static MonoArray* internal_FindDependencies(MonoObject* resource, bool recursive);
 		static bool internal_IsInternal(ScriptSceneObject* soPtr);
 		static void internal_CalculateArrayCenter(MonoArray* objects, Vector3* center);
+		static void internal_CalculateHierarchyCenter(MonoArray* objects, Vector3* center);
 	};
 
 	/** @} */
@@ -0,0 +1,77 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptEditorWidgetProfiler.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoUtil.h"
+#include "EditorWindow/BsEditorWidgetProfiler.h"
+
+namespace bs
+{
+	ScriptEditorWidgetProfiler::ScriptEditorWidgetProfiler(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptEditorWidgetProfiler::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_SetEnabled", (void*)&ScriptEditorWidgetProfiler::internal_SetEnabled);
+		metaData.scriptClass->addInternalCall("Internal_IsEnabled", (void*)&ScriptEditorWidgetProfiler::internal_IsEnabled);
+		metaData.scriptClass->addInternalCall("Internal_GetStats", (void*)&ScriptEditorWidgetProfiler::internal_GetStats);
+		metaData.scriptClass->addInternalCall("Internal_ExportChromeTrace", (void*)&ScriptEditorWidgetProfiler::internal_ExportChromeTrace);
+	}
+
+	void ScriptEditorWidgetProfiler::internal_SetEnabled(bool enabled)
+	{
+		EditorWidgetProfiler::instance().setEnabled(enabled);
+	}
+
+	bool ScriptEditorWidgetProfiler::internal_IsEnabled()
+	{
+		return EditorWidgetProfiler::instance().isEnabled();
+	}
+
+	void ScriptEditorWidgetProfiler::internal_GetStats(MonoArray** names, MonoArray** timings, MonoArray** allocs)
+	{
+		// Timings are output as a flat array, containing last, average and maximum time for each sample type, per widget
+		static constexpr UINT32 NUM_TIMINGS = 3 * (UINT32)EditorWidgetSampleType::Count;
+
+		// Only managed updates allocate managed memory, so only their last, average and maximum allocations are output
+		static constexpr UINT32 NUM_ALLOCS = 3;
+
+		Vector<EditorWidgetProfileStats> stats = EditorWidgetProfiler::instance().getStats();
+		UINT32 numEntries = (UINT32)stats.size();
+
+		ScriptArray outputNames = ScriptArray::create<String>(numEntries);
+		ScriptArray outputTimings = ScriptArray::create<float>(numEntries * NUM_TIMINGS);
+		ScriptArray outputAllocs = ScriptArray::create<UINT64>(numEntries * NUM_ALLOCS);
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			outputNames.set(i, MonoUtil::stringToMono(stats[i].name));
+
+			UINT32 idx = i * NUM_TIMINGS;
+			for (UINT32 j = 0; j < (UINT32)EditorWidgetSampleType::Count; j++)
+			{
+				outputTimings.set(idx++, stats[i].last[j]);
+				outputTimings.set(idx++, stats[i].average[j]);
+				outputTimings.set(idx++, stats[i].max[j]);
+			}
+
+			constexpr UINT32 managedIdx = (UINT32)EditorWidgetSampleType::ManagedUpdate;
+
+			UINT32 allocIdx = i * NUM_ALLOCS;
+			outputAllocs.set(allocIdx++, stats[i].lastGCAlloc[managedIdx]);
+			outputAllocs.set(allocIdx++, stats[i].averageGCAlloc[managedIdx]);
+			outputAllocs.set(allocIdx++, stats[i].maxGCAlloc[managedIdx]);
+		}
+
+		MonoUtil::referenceCopy(names, (MonoObject*)outputNames.getInternal());
+		MonoUtil::referenceCopy(timings, (MonoObject*)outputTimings.getInternal());
+		MonoUtil::referenceCopy(allocs, (MonoObject*)outputAllocs.getInternal());
+	}
+
+	MonoString* ScriptEditorWidgetProfiler::internal_ExportChromeTrace()
+	{
+		return MonoUtil::stringToMono(EditorWidgetProfiler::instance().exportChromeTrace());
+	}
+}
@@ -0,0 +1,33 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEditorPrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEditor
+	 *  @{
+	 */
+
+	/**	Interop class between C++ & CLR for EditorWidgetProfiler. */
+	class BS_SCR_BED_EXPORT ScriptEditorWidgetProfiler : public ScriptObject<ScriptEditorWidgetProfiler>
+	{
+	public:
+		SCRIPT_OBJ(EDITOR_ASSEMBLY, EDITOR_NS, "EditorWidgetProfiler")
+
+	private:
+		ScriptEditorWidgetProfiler(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_SetEnabled(bool enabled);
+		static bool internal_IsEnabled();
+		static void internal_GetStats(MonoArray** names, MonoArray** timings, MonoArray** allocs);
+		static MonoString* internal_ExportChromeTrace();
+	};
+
+	/** @} */
+}
@@ -11,6 +11,7 @@
 #include "EditorWindow/BsEditorWidget.h"
 #include "EditorWindow/BsEditorWidgetManager.h"
 #include "EditorWindow/BsEditorWidgetContainer.h"
+#include "EditorWindow/BsEditorWidgetProfiler.h"
 #include "BsMonoAssembly.h"
 #include "BsScriptObjectManager.h"
 #include "Wrappers/GUI/BsScriptGUILayout.h"
@@ -65,6 +66,10 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_SetActive", (void*)&ScriptEditorWindow::internal_setActive);
 		metaData.scriptClass->addInternalCall("Internal_IsActive", (void*)&ScriptEditorWindow::internal_isActive);
 		metaData.scriptClass->addInternalCall("Internal_IsPointerHovering", (void*)&ScriptEditorWindow::internal_isPointerHovering);
+		metaData.scriptClass->addInternalCall("Internal_MarkDirty", (void*)&ScriptEditorWindow::internal_markDirty);
+		metaData.scriptClass->addInternalCall("Internal_GetNumSkippedFrames", (void*)&ScriptEditorWindow::internal_getNumSkippedFrames);
+		metaData.scriptClass->addInternalCall("Internal_SetContinuousUpdate", (void*)&ScriptEditorWindow::internal_setContinuousUpdate);
+		metaData.scriptClass->addInternalCall("Internal_GetContinuousUpdate", (void*)&ScriptEditorWindow::internal_getContinuousUpdate);
 		metaData.scriptClass->addInternalCall("Internal_ScreenToWindowPos", (void*)&ScriptEditorWindow::internal_screenToWindowPos);
 		metaData.scriptClass->addInternalCall("Internal_WindowToScreenPos", (void*)&ScriptEditorWindow::internal_windowToScreenPos);
 
@@ -231,6 +236,34 @@ namespace bs
 		return false;
 	}
 
+	void ScriptEditorWindow::internal_markDirty(ScriptEditorWindow* thisPtr)
+	{
+		if (!thisPtr->isDestroyed())
+			thisPtr->getEditorWidget()->markDirty();
+	}
+
+	UINT64 ScriptEditorWindow::internal_getNumSkippedFrames(ScriptEditorWindow* thisPtr)
+	{
+		if (!thisPtr->isDestroyed())
+			return thisPtr->getEditorWidget()->getNumSkippedFrames();
+		else
+			return 0;
+	}
+
+	void ScriptEditorWindow::internal_setContinuousUpdate(ScriptEditorWindow* thisPtr, bool enabled)
+	{
+		if (!thisPtr->isDestroyed())
+			thisPtr->getEditorWidget()->setContinuousUpdate(enabled);
+	}
+
+	bool ScriptEditorWindow::internal_getContinuousUpdate(ScriptEditorWindow* thisPtr)
+	{
+		if (!thisPtr->isDestroyed())
+			return thisPtr->getEditorWidget()->getContinuousUpdate();
+		else
+			return false;
+	}
+
 	void ScriptEditorWindow::internal_screenToWindowPos(ScriptEditorWindow* thisPtr, Vector2I* screenPos, Vector2I* windowPos)
 	{
 		if (!thisPtr->isDestroyed())
@@ -506,9 +539,14 @@ namespace bs
 		{
 			assert(mManagedInstance == MonoUtil::getObjectFromGCHandle(mGCHandle));
 
+			EditorWidgetProfiler& profiler = EditorWidgetProfiler::instance();
+			profiler.beginSample(this, EditorWidgetSampleType::ManagedUpdate);
+
 			// Note: Not calling virtual methods. Can be easily done if needed but for now doing this
 			// for some extra speed.
 			MonoUtil::invokeThunk(mUpdateThunk, mManagedInstance);
+
+			profiler.endSample(this, EditorWidgetSampleType::ManagedUpdate);
 		}
 	}
 
@@ -111,6 +111,10 @@ namespace bs
 		static void internal_setActive(ScriptEditorWindow* thisPtr, bool active);
 		static bool internal_isActive(ScriptEditorWindow* thisPtr);
 		static bool internal_isPointerHovering(ScriptEditorWindow* thisPtr);
+		static void internal_markDirty(ScriptEditorWindow* thisPtr);
+		static UINT64 internal_getNumSkippedFrames(ScriptEditorWindow* thisPtr);
+		static void internal_setContinuousUpdate(ScriptEditorWindow* thisPtr, bool enabled);
+		static bool internal_getContinuousUpdate(ScriptEditorWindow* thisPtr);
 		static void internal_screenToWindowPos(ScriptEditorWindow* thisPtr, Vector2I* screenPos, Vector2I* windowPos);
 		static void internal_windowToScreenPos(ScriptEditorWindow* thisPtr, Vector2I* windowPos, Vector2I* screenPos);
 		static UINT32 internal_getWidth(ScriptEditorWindow* thisPtr);
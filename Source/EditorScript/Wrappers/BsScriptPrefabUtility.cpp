@@ -28,6 +28,34 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetPrefabUUID", (void*)&ScriptPrefabUtility::internal_GetPrefabUUID);
 		metaData.scriptClass->addInternalCall("Internal_UpdateFromPrefab", (void*)&ScriptPrefabUtility::internal_UpdateFromPrefab);
 		metaData.scriptClass->addInternalCall("Internal_RecordPrefabDiff", (void*)&ScriptPrefabUtility::internal_RecordPrefabDiff);
+		metaData.scriptClass->addInternalCall("Internal_RecordInstanceDiffs", (void*)&ScriptPrefabUtility::internal_RecordInstanceDiffs);
+		metaData.scriptClass->addInternalCall("Internal_UpdateInstances", (void*)&ScriptPrefabUtility::internal_UpdateInstances);
+	}
+
+	Vector<HSceneObject> ScriptPrefabUtility::findPrefabInstances(const HSceneObject& root, const UUID& prefabUUID)
+	{
+		Vector<HSceneObject> instances;
+
+		Stack<HSceneObject> todo;
+		todo.push(root);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.top();
+			todo.pop();
+
+			if (current->getPrefabLink(true) == prefabUUID)
+			{
+				instances.push_back(current);
+				continue;
+			}
+
+			UINT32 numChildren = current->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push(current->getChild(i));
+		}
+
+		return instances;
 	}
 
 	void ScriptPrefabUtility::internal_breakPrefab(ScriptSceneObject* soPtr)
@@ -110,4 +138,24 @@ namespace bs
 		HSceneObject so = soPtr->getHandle();
 		PrefabUtility::recordPrefabDiff(so);
 	}
+
+	void ScriptPrefabUtility::internal_RecordInstanceDiffs(ScriptSceneObject* rootPtr, UUID* prefabUUID)
+	{
+		if (ScriptSceneObject::checkIfDestroyed(rootPtr) || prefabUUID->empty())
+			return;
+
+		Vector<HSceneObject> instances = findPrefabInstances(rootPtr->getHandle(), *prefabUUID);
+		for (auto& instance : instances)
+			PrefabUtility::recordPrefabDiff(instance);
+	}
+
+	void ScriptPrefabUtility::internal_UpdateInstances(ScriptSceneObject* rootPtr, UUID* prefabUUID)
+	{
+		if (ScriptSceneObject::checkIfDestroyed(rootPtr) || prefabUUID->empty())
+			return;
+
+		Vector<HSceneObject> instances = findPrefabInstances(rootPtr->getHandle(), *prefabUUID);
+		for (auto& instance : instances)
+			PrefabUtility::updateFromPrefab(instance);
+	}
 }
\ No newline at end of file
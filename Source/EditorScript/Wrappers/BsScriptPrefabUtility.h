@@ -20,6 +20,13 @@ namespace bs
 	private:
 		ScriptPrefabUtility(MonoObject* instance);
 
+		/**
+		 * Finds all instances of the prefab with the provided UUID in the hierarchy of @p root. Hierarchies of the found
+		 * instances are not searched further. Only used for narrowing down which instances get updated, as each found
+		 * instance is still fully rebuilt by PrefabUtility::updateFromPrefab().
+		 */
+		static Vector<HSceneObject> findPrefabInstances(const HSceneObject& root, const UUID& prefabUUID);
+
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
@@ -31,6 +38,8 @@ namespace bs
 		static void internal_GetPrefabUUID(ScriptSceneObject* soPtr, UUID* uuid);
 		static void internal_UpdateFromPrefab(ScriptSceneObject* soPtr);
 		static void internal_RecordPrefabDiff(ScriptSceneObject* soPtr);
+		static void internal_RecordInstanceDiffs(ScriptSceneObject* rootPtr, UUID* prefabUUID);
+		static void internal_UpdateInstances(ScriptSceneObject* rootPtr, UUID* prefabUUID);
 	};
 
 	/** @} */
@@ -38,6 +38,7 @@ namespace bs
 	{
 		metaData.scriptClass->addInternalCall("Internal_Refresh", (void*)&ScriptProjectLibrary::internal_Refresh);
 		metaData.scriptClass->addInternalCall("Internal_FinalizeImports", (void*)&ScriptProjectLibrary::internal_FinalizeImports);
+		metaData.scriptClass->addInternalCall("Internal_FinishSaves", (void*)&ScriptProjectLibrary::internal_FinishSaves);
 		metaData.scriptClass->addInternalCall("Internal_Create", (void*)&ScriptProjectLibrary::internal_Create);
 		metaData.scriptClass->addInternalCall("Internal_Load", (void*)&ScriptProjectLibrary::internal_Load);
 		metaData.scriptClass->addInternalCall("Internal_Save", (void*)&ScriptProjectLibrary::internal_Save);
@@ -85,6 +86,11 @@ namespace bs
 	{
 		gProjectLibrary()._finishQueuedImports();
 	}
+
+	void ScriptProjectLibrary::internal_FinishSaves()
+	{
+		gProjectLibrary()._finishQueuedSaves(true);
+	}
 		
 	UINT32 ScriptProjectLibrary::internal_GetInProgressImportCount()
 	{
@@ -131,20 +131,17 @@ namespace bs
 			{
 				Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
 
-				for (int i = 0; i < (int)pickedObjects.size(); i++)
+				UnorderedSet<UINT64> selectedIds;
+				for (auto& so : selectedSOs)
 				{
-					bool found = false;
-					for (int j = 0; j < (int)selectedSOs.size(); j++)
-					{
-						if (selectedSOs[j] == pickedObjects[i])
-						{
-							found = true;
-							break;
-						}
-					}
-
-					if (!found)
-						selectedSOs.push_back(pickedObjects[i]);
+					if (!so.isDestroyed())
+						selectedIds.insert(so->getInstanceId());
+				}
+
+				for (auto& so : pickedObjects)
+				{
+					if (selectedIds.insert(so->getInstanceId()).second)
+						selectedSOs.push_back(so);
 				}
 
 				Selection::instance().setSceneObjects(selectedSOs);
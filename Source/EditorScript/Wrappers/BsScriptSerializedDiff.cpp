@@ -3,6 +3,7 @@
 #include "Wrappers/BsScriptSerializedDiff.h"
 #include "BsScriptMeta.h"
 #include "BsMonoClass.h"
+#include "BsMonoUtil.h"
 #include "Serialization/BsManagedSerializableObject.h"
 #include "Wrappers/BsScriptSerializedObject.h"
 #include "Serialization/BsManagedSerializableDiff.h"
@@ -11,7 +12,7 @@
 #include "Serialization/BsSerializedObject.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Utility/BsUtility.h"
-#include "Serialization/BsBinaryDiff.h"
+#include "Utility/BsBidirectionalDiff.h"
 
 namespace bs
 {
@@ -24,6 +25,7 @@ namespace bs
 	void ScriptSerializedDiff::initRuntimeData()
 	{
 		metaData.scriptClass->addInternalCall("Internal_CreateDiff", (void*)&ScriptSerializedDiff::internal_CreateDiff);
+		metaData.scriptClass->addInternalCall("Internal_CreateDiffPair", (void*)&ScriptSerializedDiff::internal_CreateDiffPair);
 		metaData.scriptClass->addInternalCall("Internal_ApplyDiff", (void*)&ScriptSerializedDiff::internal_ApplyDiff);
 		metaData.scriptClass->addInternalCall("Internal_IsEmpty", (void*)&ScriptSerializedDiff::internal_IsEmpty);
 	}
@@ -51,15 +53,64 @@ namespace bs
 			diff = diffHandler.generateDiff(oldNativeSerializedObj, newNativeSerializedObj);
 		}
 
-		if(diff)
+		return create(diff);
+	}
+
+	MonoObject* ScriptSerializedDiff::internal_CreateDiffPair(ScriptSerializedObject* oldObj,
+		ScriptSerializedObject* newObj, MonoObject** reverse)
+	{
+		MonoUtil::referenceCopy(reverse, nullptr);
+
+		SPtr<IReflectable> oldSerializedObject = oldObj->getInternal();
+		SPtr<IReflectable> newSerializedObject = newObj->getInternal();
+
+		if (oldSerializedObject == nullptr || newSerializedObject == nullptr)
+			return nullptr;
+
+		auto oldManagedSerializedObject = rtti_cast<ManagedSerializableObject>(oldSerializedObject);
+		auto newManagedSerializedObject = rtti_cast<ManagedSerializableObject>(newSerializedObject);
+
+		auto oldNativeSerializedObj = rtti_cast<SerializedObject>(oldSerializedObject);
+		auto newNativeSerializedObj = rtti_cast<SerializedObject>(newSerializedObject);
+
+		SPtr<IReflectable> forwardDiff;
+		SPtr<IReflectable> reverseDiff;
+		if(oldManagedSerializedObject != nullptr && newManagedSerializedObject != nullptr)
 		{
-			MonoObject* instance = metaData.scriptClass->createInstance();
-			new (bs_alloc<ScriptSerializedDiff>()) ScriptSerializedDiff(instance, diff);
+			forwardDiff = ManagedSerializableDiff::create(oldManagedSerializedObject, newManagedSerializedObject);
 
-			return instance;
+			// No need to look for the reverse changes if there are no forward ones
+			if(forwardDiff)
+				reverseDiff = ManagedSerializableDiff::create(newManagedSerializedObject, oldManagedSerializedObject);
 		}
+		else if(oldNativeSerializedObj != nullptr && newNativeSerializedObj != nullptr)
+		{
+			SPtr<SerializedObject> nativeForwardDiff;
+			SPtr<SerializedObject> nativeReverseDiff;
+			if(BidirectionalDiff::generate(oldNativeSerializedObj, newNativeSerializedObj, nativeForwardDiff,
+				nativeReverseDiff))
+			{
+				forwardDiff = nativeForwardDiff;
+				reverseDiff = nativeReverseDiff;
+			}
+		}
+
+		if(!forwardDiff || !reverseDiff)
+			return nullptr;
+
+		MonoUtil::referenceCopy(reverse, create(reverseDiff));
+		return create(forwardDiff);
+	}
+
+	MonoObject* ScriptSerializedDiff::create(const SPtr<IReflectable>& diff)
+	{
+		if(!diff)
+			return nullptr;
+
+		MonoObject* instance = metaData.scriptClass->createInstance();
+		new (bs_alloc<ScriptSerializedDiff>()) ScriptSerializedDiff(instance, diff);
 
-		return nullptr;
+		return instance;
 	}
 
 	void ScriptSerializedDiff::internal_ApplyDiff(ScriptSerializedDiff* thisPtr, MonoObject* obj)
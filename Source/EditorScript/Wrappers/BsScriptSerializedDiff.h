@@ -22,12 +22,17 @@ namespace bs
 	private:
 		ScriptSerializedDiff(MonoObject* instance, const SPtr<IReflectable>& obj);
 
+		/** Creates a new managed SerializedDiff instance wrapping the provided diff. */
+		static MonoObject* create(const SPtr<IReflectable>& diff);
+
 		SPtr<IReflectable> mSerializedDiff;
 
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
 		static MonoObject* internal_CreateDiff(ScriptSerializedObject* oldObj, ScriptSerializedObject* newObj);
+		static MonoObject* internal_CreateDiffPair(ScriptSerializedObject* oldObj, ScriptSerializedObject* newObj,
+			MonoObject** reverse);
 		static void internal_ApplyDiff(ScriptSerializedDiff* thisPtr, MonoObject* obj);
 		static bool internal_IsEmpty(ScriptSerializedDiff* thisPtr);
 	};
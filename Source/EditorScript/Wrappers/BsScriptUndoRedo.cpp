@@ -23,6 +23,9 @@ namespace bs
 {
 	ScriptUndoRedo* ScriptUndoRedo::sGlobalUndoRedo = nullptr;
 	HEvent ScriptUndoRedo::sDomainLoadConn;
+	HEvent ScriptUndoRedo::sStackChangedConn;
+
+	ScriptUndoRedo::OnStackChangedThunkDef ScriptUndoRedo::onStackChangedThunk;
 
 	ScriptUndoRedo::ScriptUndoRedo(MonoObject* instance, const SPtr<UndoRedo>& undoRedo)
 		:ScriptObject(instance), mUndoRedo(undoRedo)
@@ -39,15 +42,19 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_Clear", (void*)&ScriptUndoRedo::internal_Clear);
 		metaData.scriptClass->addInternalCall("Internal_GetTopCommandId", (void*)&ScriptUndoRedo::internal_GetTopCommandId);
 		metaData.scriptClass->addInternalCall("Internal_PopCommand", (void*)&ScriptUndoRedo::internal_PopCommand);
+		metaData.scriptClass->addInternalCall("Internal_GetCommandInfo", (void*)&ScriptUndoRedo::internal_GetCommandInfo);
 		metaData.scriptClass->addInternalCall("Internal_CloneSO", (void*)&ScriptUndoRedo::internal_CloneSO);
 		metaData.scriptClass->addInternalCall("Internal_CloneSOMulti", (void*)&ScriptUndoRedo::internal_CloneSOMulti);
 		metaData.scriptClass->addInternalCall("Internal_Instantiate", (void*)&ScriptUndoRedo::internal_Instantiate);
 		metaData.scriptClass->addInternalCall("Internal_CreateSO", (void*)&ScriptUndoRedo::internal_CreateSO);
 		metaData.scriptClass->addInternalCall("Internal_CreateSO2", (void*)&ScriptUndoRedo::internal_CreateSO2);
 		metaData.scriptClass->addInternalCall("Internal_DeleteSO", (void*)&ScriptUndoRedo::internal_DeleteSO);
+		metaData.scriptClass->addInternalCall("Internal_DeleteSOMulti", (void*)&ScriptUndoRedo::internal_DeleteSOMulti);
 		metaData.scriptClass->addInternalCall("Internal_ReparentSO", (void*)&ScriptUndoRedo::internal_ReparentSO);
 		metaData.scriptClass->addInternalCall("Internal_ReparentSOMulti", (void*)&ScriptUndoRedo::internal_ReparentSOMulti);
 		metaData.scriptClass->addInternalCall("Internal_BreakPrefab", (void*)&ScriptUndoRedo::internal_BreakPrefab);
+
+		onStackChangedThunk = (OnStackChangedThunkDef)metaData.scriptClass->getMethod("Internal_OnStackChanged")->getThunk();
 	}
 
 	void ScriptUndoRedo::startUp()
@@ -68,6 +75,7 @@ namespace bs
 		};
 
 		sDomainLoadConn = ScriptObjectManager::instance().onRefreshDomainLoaded.connect(createPanel);
+		sStackChangedConn = UndoRedo::instance().onStackChanged.connect(&ScriptUndoRedo::onGlobalStackChanged);
 
 		createPanel();
 	}
@@ -75,6 +83,12 @@ namespace bs
 	void ScriptUndoRedo::shutDown()
 	{
 		sDomainLoadConn.disconnect();
+		sStackChangedConn.disconnect();
+	}
+
+	void ScriptUndoRedo::onGlobalStackChanged()
+	{
+		MonoUtil::invokeThunk(onStackChangedThunk);
 	}
 
 	MonoObject* ScriptUndoRedo::create()
@@ -148,6 +162,53 @@ namespace bs
 		undoRedo->popCommand(id);
 	}
 
+	void ScriptUndoRedo::internal_GetCommandInfo(ScriptUndoRedo* thisPtr, MonoArray** types, MonoArray** descriptions,
+		MonoArray** counters, MonoArray** sizes, MonoArray** timings)
+	{
+		// Numeric data is output as flat arrays. Counters contain the id, number of commits, number of reverts and the
+		// redo flag, sizes contain the memory usage and creation time, and timings contain the last commit and revert
+		// times, for each command.
+		static constexpr UINT32 NUM_COUNTERS = 4;
+		static constexpr UINT32 NUM_SIZES = 2;
+		static constexpr UINT32 NUM_TIMINGS = 2;
+
+		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
+
+		Vector<UndoRedoCommandInfo> commands = undoRedo->getCommandInfo();
+		UINT32 numEntries = (UINT32)commands.size();
+
+		ScriptArray outputTypes = ScriptArray::create<String>(numEntries);
+		ScriptArray outputDescriptions = ScriptArray::create<String>(numEntries);
+		ScriptArray outputCounters = ScriptArray::create<INT32>(numEntries * NUM_COUNTERS);
+		ScriptArray outputSizes = ScriptArray::create<UINT64>(numEntries * NUM_SIZES);
+		ScriptArray outputTimings = ScriptArray::create<float>(numEntries * NUM_TIMINGS);
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const UndoRedoCommandInfo& info = commands[i];
+
+			outputTypes.set(i, MonoUtil::stringToMono(info.type));
+			outputDescriptions.set(i, MonoUtil::stringToMono(info.description));
+
+			outputCounters.set(i * NUM_COUNTERS + 0, (INT32)info.id);
+			outputCounters.set(i * NUM_COUNTERS + 1, (INT32)info.numCommits);
+			outputCounters.set(i * NUM_COUNTERS + 2, (INT32)info.numReverts);
+			outputCounters.set(i * NUM_COUNTERS + 3, info.isRedo ? 1 : 0);
+
+			outputSizes.set(i * NUM_SIZES + 0, info.memoryUsage);
+			outputSizes.set(i * NUM_SIZES + 1, info.creationTime);
+
+			outputTimings.set(i * NUM_TIMINGS + 0, info.lastCommitTime);
+			outputTimings.set(i * NUM_TIMINGS + 1, info.lastRevertTime);
+		}
+
+		MonoUtil::referenceCopy(types, (MonoObject*)outputTypes.getInternal());
+		MonoUtil::referenceCopy(descriptions, (MonoObject*)outputDescriptions.getInternal());
+		MonoUtil::referenceCopy(counters, (MonoObject*)outputCounters.getInternal());
+		MonoUtil::referenceCopy(sizes, (MonoObject*)outputSizes.getInternal());
+		MonoUtil::referenceCopy(timings, (MonoObject*)outputTimings.getInternal());
+	}
+
 	MonoObject* ScriptUndoRedo::internal_CloneSO(ScriptSceneObject* soPtr, MonoString* description)
 	{
 		String nativeDescription = MonoUtil::monoToString(description);
@@ -162,14 +223,19 @@ namespace bs
 		String nativeDescription = MonoUtil::monoToString(description);
 
 		ScriptArray input(soPtrs);
-		ScriptArray output = ScriptArray::create<ScriptSceneObject>(input.size());
-
+		Vector<HSceneObject> sceneObjects(input.size());
 		for (UINT32 i = 0; i < input.size(); i++)
 		{
 			ScriptSceneObject* soPtr = input.get<ScriptSceneObject*>(i);
-			HSceneObject clone = CmdCloneSO::execute(soPtr->getHandle(), nativeDescription);
+			sceneObjects[i] = soPtr->getHandle();
+		}
+
+		Vector<HSceneObject> clones = CmdCloneSO::execute(sceneObjects, nativeDescription);
+		ScriptArray output = ScriptArray::create<ScriptSceneObject>((UINT32)clones.size());
 
-			ScriptSceneObject* cloneSoPtr = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(clone);
+		for (UINT32 i = 0; i < (UINT32)clones.size(); i++)
+		{
+			ScriptSceneObject* cloneSoPtr = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(clones[i]);
 			output.set(i, cloneSoPtr->getManagedInstance());
 		}
 
@@ -244,6 +310,21 @@ namespace bs
 		CmdDeleteSO::execute(soPtr->getHandle(), nativeDescription);
 	}
 
+	void ScriptUndoRedo::internal_DeleteSOMulti(MonoArray* soPtrs, MonoString* description)
+	{
+		String nativeDescription = MonoUtil::monoToString(description);
+
+		ScriptArray input(soPtrs);
+		Vector<HSceneObject> sceneObjects(input.size());
+		for (UINT32 i = 0; i < input.size(); i++)
+		{
+			ScriptSceneObject* soPtr = input.get<ScriptSceneObject*>(i);
+			sceneObjects[i] = soPtr->getHandle();
+		}
+
+		CmdDeleteSO::execute(sceneObjects, nativeDescription);
+	}
+
 	void ScriptUndoRedo::internal_ReparentSO(ScriptSceneObject* soPtr, ScriptSceneObject* parentSOPtr, MonoString* description)
 	{
 		HSceneObject parent;
@@ -265,12 +346,14 @@ namespace bs
 		String nativeDescription = MonoUtil::monoToString(description);
 
 		ScriptArray input(soPtrs);
+		Vector<HSceneObject> sceneObjects(input.size());
 		for (UINT32 i = 0; i < input.size(); i++)
 		{
 			ScriptSceneObject* soPtr = input.get<ScriptSceneObject*>(i);
-			HSceneObject so = soPtr->getHandle();
-			CmdReparentSO::execute(so, parent, nativeDescription);
+			sceneObjects[i] = soPtr->getHandle();
 		}
+
+		CmdReparentSO::execute(sceneObjects, parent, nativeDescription);
 	}
 
 	void ScriptUndoRedo::internal_BreakPrefab(ScriptSceneObject* soPtr, MonoString* description)
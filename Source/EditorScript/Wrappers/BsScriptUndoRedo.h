@@ -32,10 +32,17 @@ namespace bs
 	private:
 		ScriptUndoRedo(MonoObject* instance, const SPtr<UndoRedo>& undoRedo);
 
+		/** Triggered when commands are added to, removed from or moved between the global undo and redo stacks. */
+		static void onGlobalStackChanged();
+
 		SPtr<UndoRedo> mUndoRedo;
 
 		static ScriptUndoRedo* sGlobalUndoRedo;
 		static HEvent sDomainLoadConn;
+		static HEvent sStackChangedConn;
+
+		typedef void(BS_THUNKCALL *OnStackChangedThunkDef) (MonoException**);
+		static OnStackChangedThunkDef onStackChangedThunk;
 		
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
@@ -49,12 +56,15 @@ namespace bs
 		static void internal_Clear(ScriptUndoRedo* thisPtr);
 		static UINT32 internal_GetTopCommandId(ScriptUndoRedo* thisPtr);
 		static void internal_PopCommand(ScriptUndoRedo* thisPtr, UINT32 id);
+		static void internal_GetCommandInfo(ScriptUndoRedo* thisPtr, MonoArray** types, MonoArray** descriptions,
+			MonoArray** counters, MonoArray** sizes, MonoArray** timings);
 		static MonoObject* internal_CloneSO(ScriptSceneObject* soPtr, MonoString* description);
 		static MonoArray* internal_CloneSOMulti(MonoArray* soPtrs, MonoString* description);
 		static MonoObject* internal_Instantiate(ScriptPrefab* prefabPtr, MonoString* description);
 		static MonoObject* internal_CreateSO(MonoString* name, MonoString* description);
 		static MonoObject* internal_CreateSO2(MonoString* name, MonoArray* types, MonoString* description);
 		static void internal_DeleteSO(ScriptSceneObject* soPtr, MonoString* description);
+		static void internal_DeleteSOMulti(MonoArray* soPtrs, MonoString* description);
 		static void internal_ReparentSO(ScriptSceneObject* soPtr, ScriptSceneObject* parentSOPtr, MonoString* description);
 		static void internal_ReparentSOMulti(MonoArray* soPtrs, ScriptSceneObject* parentSOPtr, MonoString* description);
 		static void internal_BreakPrefab(ScriptSceneObject* soPtr, MonoString* description);